@@ -0,0 +1,297 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Compares pipes stored as engine-like objects with pipes stored in archetype columns.
+*/
+
+#include "src/ecs/ArchetypeStorage.hpp"
+#include "src/sim/GameRules.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#ifdef __linux__
+ #include <cstring>
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif // __linux__
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float STEP = 1.0f / 60;
+
+    struct BenchOptions {
+        std::vector<std::size_t> pipes;
+        std::size_t steps = 2000;
+    };
+
+    struct BenchResult {
+        double seconds = 0;
+        std::int64_t cacheMisses = -1;
+        double checksum = 0;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-archetype-bench [options]\n"
+            << "  --pipes <n>    live pipes to move, repeat to compare several counts (default 256, 1024 and 16384)\n"
+            << "  --steps <n>    simulation steps run for each count (default 2000)\n";
+    }
+
+    BenchOptions parseOptions(const int argc, char *argv[])
+    {
+        BenchOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--pipes") {
+                options.pipes.push_back(std::stoul(value));
+            } else if (flag == "--steps") {
+                options.steps = std::stoul(value);
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.pipes.empty()) {
+            options.pipes = {256, 1024, 16384};
+        }
+        if (options.steps == 0 || std::find(options.pipes.begin(), options.pipes.end(), 0) != options.pipes.end()) {
+            throw std::invalid_argument("--pipes and --steps must be positive");
+        }
+        return options;
+    }
+
+#ifdef __linux__
+    // Counts the hardware cache misses of this thread, unavailable in most containers and VMs.
+    class CacheMissCounter {
+    public:
+        CacheMissCounter()
+        {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof(attributes);
+            attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            _fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        }
+
+        ~CacheMissCounter()
+        {
+            if (_fd >= 0) {
+                close(_fd);
+            }
+        }
+
+        CacheMissCounter(const CacheMissCounter &) = delete;
+        CacheMissCounter &operator=(const CacheMissCounter &) = delete;
+
+        void start() const
+        {
+            if (_fd >= 0) {
+                ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+
+        std::int64_t stop() const
+        {
+            std::int64_t count = 0;
+            if (_fd < 0) {
+                return -1;
+            }
+            ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+            return read(_fd, &count, sizeof(count)) == sizeof(count) ? count : -1;
+        }
+
+    private:
+        int _fd = -1;
+    };
+#else
+    class CacheMissCounter {
+    public:
+        void start() const {}
+        std::int64_t stop() const { return -1; }
+    };
+#endif // __linux__
+
+    // Stand-ins for the engine components: polymorphic, heap allocated and found by a cast.
+    struct Component {
+        virtual ~Component() = default;
+    };
+
+    struct TransformComponent final : Component {
+        float position[3] = {0, 0, 0};
+        float previous[3] = {0, 0, 0};
+        float rotation[3] = {0, 0, 0};
+        float scale[3] = {1, 1, 1};
+    };
+
+    struct RigidBodyComponent final : Component {
+        float velocity[3] = {0, 0, 0};
+        float acceleration[3] = {0, 0, 0};
+        float terminalVelocity = 0;
+        float drag = 0;
+        void *collider = nullptr;
+    };
+
+    struct SpriteComponent final : Component {
+        char texture[96] = {};
+    };
+
+    struct BoxComponent final : Component {
+        float position[3] = {0, 0, 0};
+        float size[3] = {0, 0, 0};
+    };
+
+    struct Object {
+        std::vector<std::unique_ptr<Component>> components;
+
+        template <typename T>
+        T *getComponent()
+        {
+            for (const auto &component : components) {
+                if (auto *found = dynamic_cast<T *>(component.get())) {
+                    return found;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    float spawnX(const std::size_t i, const std::size_t count)
+    {
+        return GameRules::PIPE_SPAWN_X * static_cast<float>(i) / static_cast<float>(count);
+    }
+
+    // The objects are created in a shuffled order between unrelated allocations, like a scene that has been running a while.
+    BenchResult benchObjects(const std::size_t count, const std::size_t steps, const CacheMissCounter &counter)
+    {
+        std::mt19937 random(42);
+        std::vector<std::unique_ptr<Object>> objects(count);
+        std::vector<std::unique_ptr<char[]>> clutter;
+        std::vector<std::size_t> order(count);
+        for (std::size_t i = 0; i < count; i++) {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), random);
+        for (const std::size_t i : order) {
+            auto object = std::make_unique<Object>();
+            object->components.push_back(std::make_unique<TransformComponent>());
+            clutter.push_back(std::make_unique<char[]>(64 + random() % 512));
+            object->components.push_back(std::make_unique<SpriteComponent>());
+            object->components.push_back(std::make_unique<RigidBodyComponent>());
+            clutter.push_back(std::make_unique<char[]>(64 + random() % 512));
+            object->components.push_back(std::make_unique<BoxComponent>());
+            object->getComponent<TransformComponent>()->position[0] = spawnX(i, count);
+            object->getComponent<RigidBodyComponent>()->velocity[0] = -GameRules::PIPE_SPEED;
+            objects[i] = std::move(object);
+        }
+        BenchResult result;
+        counter.start();
+        const auto started = Clock::now();
+        for (std::size_t step = 0; step < steps; step++) {
+            for (const auto &object : objects) {
+                auto *transform = object->getComponent<TransformComponent>();
+                auto *rigidbody = object->getComponent<RigidBodyComponent>();
+                for (int axis = 0; axis < 3; axis++) {
+                    transform->previous[axis] = transform->position[axis];
+                    rigidbody->velocity[axis] += rigidbody->acceleration[axis] * STEP;
+                    transform->position[axis] += rigidbody->velocity[axis] * STEP;
+                }
+            }
+        }
+        result.seconds = std::chrono::duration<double>(Clock::now() - started).count();
+        result.cacheMisses = counter.stop();
+        for (const auto &object : objects) {
+            result.checksum += object->getComponent<TransformComponent>()->position[0];
+        }
+        return result;
+    }
+
+    BenchResult benchArchetypes(const std::size_t count, const std::size_t steps, const CacheMissCounter &counter)
+    {
+        ArchetypeStorage storage;
+        storage.reserve(TRANSFORM | RIGIDBODY, count);
+        std::vector<Entity> entities(count);
+        for (std::size_t i = 0; i < count; i++) {
+            entities[i] = storage.create(TRANSFORM | RIGIDBODY);
+            storage.transform(entities[i]).setPosition({spawnX(i, count), 0, 0});
+            storage.rigidBody(entities[i]).setVelocity({-GameRules::PIPE_SPEED, 0, 0});
+        }
+        BenchResult result;
+        counter.start();
+        const auto started = Clock::now();
+        for (std::size_t step = 0; step < steps; step++) {
+            storage.integrate(STEP);
+        }
+        result.seconds = std::chrono::duration<double>(Clock::now() - started).count();
+        result.cacheMisses = counter.stop();
+        for (const Entity entity : entities) {
+            result.checksum += storage.transform(entity).getPosition().x;
+        }
+        return result;
+    }
+
+    void report(const char *name, const BenchResult &result, const std::size_t count, const std::size_t steps)
+    {
+        const double updates = static_cast<double>(count) * static_cast<double>(steps);
+        std::cout << name << ": " << result.seconds * 1e9 / updates << " ns/pipe, "
+            << updates / result.seconds / 1e6 << " M pipes/s, cache misses/pipe ";
+        if (result.cacheMisses < 0) {
+            std::cout << "n/a";
+        } else {
+            std::cout << static_cast<double>(result.cacheMisses) / updates;
+        }
+        std::cout << "\n";
+    }
+
+    int run(const BenchOptions &options)
+    {
+        const CacheMissCounter counter;
+        bool matched = true;
+        for (const std::size_t count : options.pipes) {
+            const BenchResult objects = benchObjects(count, options.steps, counter);
+            const BenchResult archetypes = benchArchetypes(count, options.steps, counter);
+            std::cout << count << " live pipes, " << options.steps << " steps\n";
+            report("  objects and getComponent", objects, count, options.steps);
+            report("  archetype columns       ", archetypes, count, options.steps);
+            std::cout << "  " << objects.seconds / (archetypes.seconds > 0 ? archetypes.seconds : 1e-9) << "x faster\n";
+            matched = matched && std::abs(objects.checksum - archetypes.checksum) <= 1e-6 * std::abs(objects.checksum) + 1e-3;
+        }
+        if (!matched) {
+            std::cerr << "The two storages ended with different positions" << std::endl;
+        }
+        return matched ? 0 : 2;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return run(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -12,6 +12,7 @@
 #include "StellarForge/Common/json/JsonNull.hpp"
 #include "StellarForge/Common/utils/Logger.hpp"
 #include "StellarForge/Common/components/Transform.hpp"
+#include "src/audit/AllocationAudit.hpp"
 
 extern "C"  {
     SYMBOL const char **getComponentName() {
@@ -68,9 +69,16 @@ public:
     }
 
     void runComponent() override {
+        ALLOCATION_SCOPE("DynamicComponent");
+        // Only log on the first run: the bird moves every frame, so logging moves would build a string per frame.
+        if (_logged) {
+            return;
+        }
+        _logged = true;
         const auto *transformComponent = getParentComponent<Transform>();
         if (transformComponent != nullptr) {
-            const std::string str= "I Dynamicly know the position of the object: " + std::to_string(transformComponent->getPosition().x) + ", " + std::to_string(transformComponent->getPosition().y) + ", " + std::to_string(transformComponent->getPosition().z) + "\n";
+            const auto &position = transformComponent->getPosition();
+            const std::string str= "I Dynamicly know the position of the object: " + std::to_string(position.x) + ", " + std::to_string(position.y) + ", " + std::to_string(position.z) + "\n";
             this->_log.info << str;
             return;
         }
@@ -83,6 +91,7 @@ public:
 
 protected:
     Logger _log;
+    bool _logged = false;
 
     [[nodiscard]] json::IJsonObject *serializeData() const override {
         return new json::JsonNull();
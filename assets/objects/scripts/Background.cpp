@@ -6,19 +6,26 @@
 */
 
 #include "Background.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/sim/Simulation.hpp"
+#include "src/sim/SimulationClock.hpp"
+#include "src/state/GameState.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
 
 using Vector3 = glm::vec3;
 
 Background::Background(IObject *owner, const json::IJsonObject *data) : CPPMonoBehaviour(owner) {}
 
 void Background::start() {
-    startTime = std::chrono::high_resolution_clock::now();
-    actualTime = std::chrono::high_resolution_clock::now();
+    position = 0;
+    previousPosition = 0;
     auto *transform = getParentComponent<Transform>();
     transform->setPosition(Vector3(0, 0, 0));
-    EventSystem::getInstance().registerListener("bird_died", [this](const EventData& data) {
+    listeners.listen("bird_died", [this](const EventData& data) {
         onGameLost(data);
     });
+    GameState::getInstance().registerParticipant(this);
 }
 
 void Background::onGameLost(const EventData &data)
@@ -27,14 +34,28 @@ void Background::onGameLost(const EventData &data)
 }
 
 void Background::update() {
-    actualTime = std::chrono::high_resolution_clock::now();
-    if (std::chrono::duration<float>(actualTime - startTime).count() >= 0.01f && !gameLost) {
-        auto *transform = getParentComponent<Transform>();
-        transform->setPosition(Vector3(transform->getPosition().x - 5, transform->getPosition().y, -10));
-        if (transform->getPosition().x <= -1920) {
-            transform->setPosition(Vector3(0, transform->getPosition().y, -10));
-        }
-        startTime = actualTime;
+    ALLOCATION_SCOPE("Background");
+    FRAME_SECTION("Background");
+    const auto &clock = SimulationClock::getInstance();
+    for (unsigned i = 0; i < clock.getSteps(); i++) {
+        step(clock.getStep());
+    }
+    const float x = previousPosition + (position - previousPosition) * clock.getAlpha();
+    // Stops writing once the scroll stops, at game over.
+    auto *transform = getParentComponent<Transform>();
+    if (const auto &current = transform->getPosition(); current.x != x || current.z != -10) {
+        transform->setPosition(Vector3(x, current.y, -10));
+    }
+}
+
+void Background::step(const float step) {
+    previousPosition = position;
+    if (gameLost) {
+        return;
+    }
+    if (Simulation::scrollBackground(position, GameRules::BACKGROUND_SPEED * speed * step)) {
+        // Wrap both states so the interpolation does not sweep back across the screen.
+        previousPosition += GameRules::SCREEN_WIDTH;
     }
 }
 
@@ -54,9 +75,32 @@ IComponent *Background::clone (IObject *owner) const {
 
 void Background::deserialize(const json::IJsonObject *data) {}
 
-void Background::end() {}
+void Background::end() {
+    listeners.clear();
+    GameState::getInstance().unregisterParticipant(this);
+}
 
 json::IJsonObject *Background::serializeData() const
 {
     return nullptr;
 }
+
+void Background::saveState(GameSnapshot &snapshot) {
+    snapshot.backgroundX = position;
+}
+
+void Background::loadState(const GameSnapshot &snapshot) {
+    auto *transform = getParentComponent<Transform>();
+    position = snapshot.backgroundX;
+    previousPosition = position;
+    transform->setPosition(Vector3(position, transform->getPosition().y, -10));
+    gameLost = snapshot.gameOver;
+}
+
+void Background::resetState() {
+    auto *transform = getParentComponent<Transform>();
+    position = 0;
+    previousPosition = 0;
+    gameLost = false;
+    transform->setPosition(Vector3(position, transform->getPosition().y, -10));
+}
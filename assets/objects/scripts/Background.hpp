@@ -8,11 +8,12 @@
 #ifndef BACKGROUND_HPP
 #define BACKGROUND_HPP
 
-#include <chrono>
 #include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
 #include "StellarForge/Common/components/Transform.hpp"
 #include "StellarForge/Common/json/JsonObject.hpp"
 #include "StellarForge/Common/event/EventSystem.hpp"
+#include "src/events/ListenerScope.hpp"
+#include "src/state/ISnapshotable.hpp"
 
 /**
  * @class Background
@@ -21,7 +22,7 @@
  * @since v0.1.0
  * @author Aubane Nourry
  */
-class Background final : public CPPMonoBehaviour {
+class Background final : public CPPMonoBehaviour, public ISnapshotable {
 public:
     /**
      * @brief Constructor for the Background class.
@@ -50,7 +51,7 @@ public:
     void start() override;
 
     /**
-     * @brief Updates the background every frame.
+     * @brief Runs the fixed simulation steps due on this frame and presents the interpolated scroll.
      * @version v0.1.0
      * @since v0.1.0
      * @author Aubane Nourry
@@ -120,16 +121,47 @@ public:
      */
     json::IJsonObject *serializeData() const override;
 
+    /**
+     * @brief Copies the background scroll position into a snapshot.
+     * @param snapshot Snapshot to fill.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void saveState(GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Puts the background back in the state recorded in a snapshot.
+     * @param snapshot Snapshot to restore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void loadState(const GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Puts the background back at its origin.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void resetState() override;
+
 private:
+    /**
+     * @brief Advances the scroll by one simulation step.
+     * @param step Duration of the step in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void step(float step);
+
     float speed = 1.00f; ///< Speed of the background scrolling
-    #ifdef _WIN32
-     std::chrono::steady_clock::time_point startTime;
-     std::chrono::steady_clock::time_point actualTime;
-    #else
-     std::chrono::system_clock::time_point startTime;
-     std::chrono::system_clock::time_point actualTime;
-    #endif // _WIN32
+    float position = 0; ///< Simulated scroll position
+    float previousPosition = 0; ///< Simulated scroll position one step earlier
     bool gameLost = false; ///< Indicates if the game is lost
+    ListenerScope listeners; ///< Game-over listener, removed in end()
 };
 
 #endif // BACKGROUND_HPP
@@ -6,6 +6,13 @@
 */
 
 #include "Bird.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include "src/sim/Simulation.hpp"
+#include "src/sim/SimulationClock.hpp"
+#include "src/state/GameState.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+#include "src/telemetry/Telemetry.hpp"
 
 using Vector3 = glm::vec3;
 
@@ -15,18 +22,22 @@ Bird::Bird(IObject *owner, const json::IJsonObject *data) : CPPMonoBehaviour(own
 
 void Bird::start()
 {
+    // The bird is moved by the fixed simulation step, the rigidbody only provides the collider.
     auto *rigidbody = getParentComponent<RigidBody>();
-    rigidbody->_velocity = Vector3(0, 100, 0);
-    rigidbody->_acceleration = Vector3(0, 500, 0);
-    rigidbody->_terminalVelocity = 500;
-    rigidbody->_drag = 10;
+    rigidbody->_velocity = Vector3(0, 0, 0);
+    rigidbody->_acceleration = Vector3(0, 0, 0);
+    rigidbody->_terminalVelocity = 0;
+    rigidbody->_drag = 0;
+    spawnPosition = getParentComponent<Transform>()->getPosition();
+    resetState();
+    GameState::getInstance().registerParticipant(this);
 
-    EventSystem::getInstance().registerListener("space_pressed", [this](const EventData& data) {
+    listeners.listen("space_pressed", [this](const EventData& data) {
         if (!isDead) {
             jump();
         }
     });
-    EventSystem::getInstance().registerListener("z_pressed", [this](const EventData& data) {
+    listeners.listen("z_pressed", [this](const EventData& data) {
         if (!isDead) {
             jump();
         }
@@ -35,33 +46,62 @@ void Bird::start()
 
 void Bird::update()
 {
-    auto *transform = getParentComponent<Transform>();
-    auto *rigidbody = getParentComponent<RigidBody>();
-    if (isDead) {
-        return;
+    simulate();
+    if (deathPending) {
+        // Triggered once the audited scope is closed: the game-over listeners format text and submit the result.
+        deathPending = false;
+        EventSystem::getInstance().triggerEvents("bird_died", nullptr);
+    }
+}
+
+void Bird::simulate()
+{
+    ALLOCATION_SCOPE("Bird");
+    FRAME_SECTION("Bird");
+    const auto &clock = SimulationClock::getInstance();
+    if (clock.getSteps() > 0) {
+        // The pipe spawner comes after the bird in the scene, so its pipes are still where this frame starts.
+        GameState::getInstance().capture(collisionState);
     }
-    if (transform->getPosition().y < 0 || transform->getPosition().y > 1000) {
-        die();
+    for (unsigned i = 0; i < clock.getSteps(); i++) {
+        step(clock.getStep());
     }
-    if (const std::vector<IObject *> colliding_objects = rigidbody->collidingObjects(); !colliding_objects.empty()) {
-        die();
+    auto *transform = getParentComponent<Transform>();
+    transform->setPosition(previousPosition + (position - previousPosition) * clock.getAlpha());
+}
+
+void Bird::step(const float step)
+{
+    previousPosition = position;
+    saveState(collisionState);
+    // The same step as flappy-headless and flappy-race, the other components only apply its world rules to themselves.
+    const Contact contact = Simulation::step(collisionState, false, step);
+    position.x = collisionState.birdX;
+    position.y = collisionState.birdY;
+    velocity.y = collisionState.birdVelocityY;
+    acceleration = collisionState.birdAccelerationY;
+    terminalVelocity = collisionState.birdTerminalVelocity;
+    if (contact.impact != Impact::NONE) {
+        Telemetry::getInstance().recordDeath(contact.impact == Impact::PIPE ? DeathCause::PIPE
+            : contact.impact == Impact::CEILING ? DeathCause::CEILING : DeathCause::GROUND);
+        // The step already gave the bird its death velocity and gravity.
+        isDead = true;
+        deathPending = true;
     }
 }
 
 void Bird::jump()
 {
-    auto *rigidbody = getParentComponent<RigidBody>();
-    rigidbody->_velocity = Vector3(0, -jumpForce, 0);
+    velocity = Vector3(0, -jumpForce, 0);
 }
 
 void Bird::die()
 {
     isDead = true;
-    auto *rigidbody = getParentComponent<RigidBody>();
-    rigidbody->_velocity = Vector3(0, 100, 0);
-    rigidbody->_acceleration = Vector3(0, 1000, 0);
-    rigidbody->_terminalVelocity = 0;
-    EventSystem::getInstance().triggerEvents("bird_died", nullptr);
+    velocity = Vector3(0, GameRules::BIRD_DEATH_VELOCITY, 0);
+    acceleration = GameRules::BIRD_DEATH_GRAVITY;
+    terminalVelocity = 0;
+    deathPending = true;
 }
 
 void Bird::setJumpForce(float newJumpForce)
@@ -87,9 +127,46 @@ void Bird::deserialize(const json::IJsonObject *data)
 
 void Bird::end()
 {
+    listeners.clear();
+    GameState::getInstance().unregisterParticipant(this);
 }
 
 json::IJsonObject *Bird::serializeData() const
 {
     return nullptr;
 }
+
+void Bird::saveState(GameSnapshot &snapshot)
+{
+    snapshot.birdX = position.x;
+    snapshot.birdY = position.y;
+    snapshot.birdVelocityX = velocity.x;
+    snapshot.birdVelocityY = velocity.y;
+    snapshot.birdAccelerationY = acceleration;
+    snapshot.birdTerminalVelocity = terminalVelocity;
+    snapshot.birdDead = isDead;
+}
+
+void Bird::loadState(const GameSnapshot &snapshot)
+{
+    auto *transform = getParentComponent<Transform>();
+    position = Vector3(snapshot.birdX, snapshot.birdY, transform->getPosition().z);
+    previousPosition = position;
+    velocity = Vector3(snapshot.birdVelocityX, snapshot.birdVelocityY, 0);
+    acceleration = snapshot.birdAccelerationY;
+    terminalVelocity = snapshot.birdTerminalVelocity;
+    transform->setPosition(position);
+    isDead = snapshot.birdDead;
+}
+
+void Bird::resetState()
+{
+    position = spawnPosition;
+    previousPosition = position;
+    velocity = Vector3(0, GameRules::BIRD_START_VELOCITY, 0);
+    acceleration = GameRules::BIRD_GRAVITY;
+    terminalVelocity = GameRules::BIRD_TERMINAL_VELOCITY;
+    isDead = false;
+    deathPending = false;
+    getParentComponent<Transform>()->setPosition(position);
+}
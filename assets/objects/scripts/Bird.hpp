@@ -14,6 +14,9 @@
 #include "StellarForge/Common/json/JsonObject.hpp"
 #include "StellarForge/Common/event/EventSystem.hpp"
 #include "StellarForge/Physics/Box.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/events/ListenerScope.hpp"
+#include "src/state/ISnapshotable.hpp"
 
 /**
  * @class Bird
@@ -22,7 +25,7 @@
  * @since v0.1.0
  * @author Landry Gigant
  */
-class Bird : public CPPMonoBehaviour {
+class Bird : public CPPMonoBehaviour, public ISnapshotable {
 public:
     /**
      * @brief Constructor for the Bird class.
@@ -51,7 +54,7 @@ public:
     void start() override;
 
     /**
-     * @brief Updates the bird's position and state every frame.
+     * @brief Runs the fixed simulation steps due on this frame and presents the interpolated bird.
      * @version v0.1.0
      * @since v0.1.0
      * @author Landry Gigant
@@ -67,7 +70,7 @@ public:
     void jump();
 
     /**
-     * @brief Handles the bird's death.
+     * @brief Handles the bird's death, the bird_died event is triggered at the end of the frame's update.
      * @version v0.1.0
      * @since v0.1.0
      * @authors Landry Gigant & Aubane Nourry
@@ -128,9 +131,61 @@ public:
      */
     json::IJsonObject *serializeData() const override;
 
+    /**
+     * @brief Copies the bird's simulated motion and death flag into a snapshot.
+     * @param snapshot Snapshot to fill.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void saveState(GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Puts the bird back in the state recorded in a snapshot.
+     * @param snapshot Snapshot to restore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void loadState(const GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Puts the bird back at its spawn position, alive.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void resetState() override;
+
 private:
-    float jumpForce = 250.0f; ///< Force applied when the bird jumps
+    /**
+     * @brief Runs the fixed simulation steps due on this frame and presents the interpolated bird, inside the audited scope.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void simulate();
+
+    /**
+     * @brief Integrates the bird's motion for one simulation step.
+     * @param step Duration of the step in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void step(float step);
+
+    float jumpForce = GameRules::BIRD_JUMP_FORCE; ///< Force applied when the bird jumps
+    glm::vec3 position {}; ///< Simulated position
+    glm::vec3 previousPosition {}; ///< Simulated position one step earlier
+    glm::vec3 velocity {}; ///< Simulated velocity
+    float acceleration = GameRules::BIRD_GRAVITY; ///< Simulated vertical acceleration
+    float terminalVelocity = GameRules::BIRD_TERMINAL_VELOCITY; ///< Simulated terminal velocity, 0 for none
+    GameSnapshot collisionState; ///< Reused capture of the play state for the swept collision test
     bool isDead = false; ///< Indicates if the bird is dead
+    bool deathPending = false; ///< The bird died during this frame's steps, bird_died is not triggered yet
+    glm::vec3 spawnPosition {}; ///< Position the bird starts every game at
+    ListenerScope listeners; ///< Input listeners, removed in end()
 };
 
 #endif // STELLARFORGE_BIRD_HPP
@@ -0,0 +1,171 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LuaScript.cpp
+*/
+
+#include "LuaScript.hpp"
+#include <stdexcept>
+#include "StellarForge/Common/json/JsonString.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+
+namespace {
+    struct Binding {
+        const char *table;
+        const char *fields[3];
+    };
+
+    constexpr Binding POSITION = {"transform", {"position_x", "position_y", "position_z"}};
+    constexpr Binding VELOCITY = {"rigidbody", {"velocity_x", "velocity_y", "velocity_z"}};
+    constexpr Binding ACCELERATION = {"rigidbody", {"acceleration_x", "acceleration_y", "acceleration_z"}};
+    constexpr Binding COLOR = {"text", {"colorR", "colorG", "colorB"}};
+
+    // The engine hands the data object or its "invisible" group; the path is read from either.
+    const json::JsonString *scriptField(const json::IJsonObject *data)
+    {
+        const auto *object = dynamic_cast<const json::JsonObject *>(data);
+        if (object == nullptr) {
+            return nullptr;
+        }
+        if (const auto *group = object->getValue<json::JsonObject>("invisible"); group != nullptr) {
+            object = group;
+        }
+        return object->getValue<json::JsonString>("Script");
+    }
+
+    void pushVector(LuaVM &vm, const int environment, const Binding &binding, const glm::vec3 &value)
+    {
+        for (int i = 0; i < 3; i++) {
+            vm.setNumber(environment, binding.table, binding.fields[i], value[i]);
+        }
+    }
+
+    // Reads back a vector, returns false when the script left it as it was given.
+    bool pullVector(LuaVM &vm, const int environment, const Binding &binding, const glm::vec3 &pushed, glm::vec3 &value)
+    {
+        bool changed = false;
+        for (int i = 0; i < 3; i++) {
+            value[i] = static_cast<float>(vm.getNumber(environment, binding.table, binding.fields[i], pushed[i]));
+            changed = changed || value[i] != pushed[i];
+        }
+        return changed;
+    }
+}
+
+LuaScript::LuaScript(IObject *owner, const json::IJsonObject *data)
+    : CPPMonoBehaviour(owner)
+{
+    deserialize(data);
+}
+
+IComponent *LuaScript::clone(IObject *owner) const
+{
+    auto *comp = new LuaScript(owner, nullptr);
+    comp->scriptPath = scriptPath;
+    return comp;
+}
+
+void LuaScript::start()
+{
+    if (scriptPath.empty()) {
+        throw std::runtime_error("LuaScript has no \"Script\" to run");
+    }
+    auto &vm = LuaVM::getInstance();
+    chunk = vm.compile(scriptPath);
+    vm.releaseEnvironment(environment);
+    environment = vm.createEnvironment();
+    if (getParentComponent<Transform>() != nullptr) {
+        vm.addTable(environment, POSITION.table);
+    }
+    if (getParentComponent<RigidBody>() != nullptr) {
+        vm.addTable(environment, VELOCITY.table);
+    }
+    if (getParentComponent<UIText>() != nullptr) {
+        vm.addTable(environment, COLOR.table);
+    }
+    firstRun = true;
+    failed = false;
+}
+
+void LuaScript::update()
+{
+    ALLOCATION_SCOPE("LuaScript");
+    FRAME_SECTION("LuaScript");
+    if (failed || environment == LuaVM::NO_REFERENCE) {
+        return;
+    }
+    auto &vm = LuaVM::getInstance();
+    pushBindings();
+    vm.setFlag(environment, "start", firstRun);
+    firstRun = false;
+    if (!vm.run(chunk, environment)) {
+        failed = true;
+        return;
+    }
+    pullBindings();
+}
+
+void LuaScript::pushBindings()
+{
+    auto &vm = LuaVM::getInstance();
+    if (const auto *transform = getParentComponent<Transform>(); transform != nullptr) {
+        pushedPosition = transform->getPosition();
+        pushVector(vm, environment, POSITION, pushedPosition);
+    }
+    if (const auto *rigidbody = getParentComponent<RigidBody>(); rigidbody != nullptr) {
+        pushedVelocity = rigidbody->_velocity;
+        pushedAcceleration = rigidbody->_acceleration;
+        pushVector(vm, environment, VELOCITY, pushedVelocity);
+        pushVector(vm, environment, ACCELERATION, pushedAcceleration);
+    }
+    if (auto *text = getParentComponent<UIText>(); text != nullptr && text->getText() != nullptr) {
+        const sf::Color color = text->getText()->getFillColor();
+        pushedColor = glm::vec3(color.r, color.g, color.b);
+        pushVector(vm, environment, COLOR, pushedColor);
+    }
+}
+
+void LuaScript::pullBindings()
+{
+    auto &vm = LuaVM::getInstance();
+    glm::vec3 value;
+    // Only changed values are written back, so a script does not fight the components that move its object.
+    if (auto *transform = getParentComponent<Transform>(); transform != nullptr && pullVector(vm, environment, POSITION, pushedPosition, value)) {
+        transform->setPosition(value);
+    }
+    if (auto *rigidbody = getParentComponent<RigidBody>(); rigidbody != nullptr) {
+        if (pullVector(vm, environment, VELOCITY, pushedVelocity, value)) {
+            rigidbody->_velocity = value;
+        }
+        if (pullVector(vm, environment, ACCELERATION, pushedAcceleration, value)) {
+            rigidbody->_acceleration = value;
+        }
+    }
+    if (auto *text = getParentComponent<UIText>(); text != nullptr && text->getText() != nullptr
+        && pullVector(vm, environment, COLOR, pushedColor, value)) {
+        const sf::Color color = text->getText()->getFillColor();
+        value = glm::clamp(value, 0.0f, 255.0f);
+        text->getText()->setFillColor(sf::Color(static_cast<sf::Uint8>(value.r), static_cast<sf::Uint8>(value.g),
+            static_cast<sf::Uint8>(value.b), color.a));
+    }
+}
+
+void LuaScript::deserialize(const json::IJsonObject *data)
+{
+    if (const auto *field = scriptField(data); field != nullptr) {
+        scriptPath = field->getValue();
+    }
+}
+
+void LuaScript::end()
+{
+    LuaVM::getInstance().releaseEnvironment(environment);
+    environment = LuaVM::NO_REFERENCE;
+}
+
+json::IJsonObject *LuaScript::serializeData() const
+{
+    return nullptr;
+}
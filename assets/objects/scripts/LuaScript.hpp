@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LuaScript.hpp
+*/
+
+#ifndef STELLARFORGE_LUASCRIPT_HPP
+#define STELLARFORGE_LUASCRIPT_HPP
+
+#include <string>
+#include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
+#include "StellarForge/Common/components/Transform.hpp"
+#include "StellarForge/Physics/components/RigidBody.hpp"
+#include "StellarForge/Graphics/components/UIText.hpp"
+#include "StellarForge/Common/json/JsonObject.hpp"
+#include "src/script/LuaVM.hpp"
+
+/**
+ * @class LuaScript
+ * @brief Runs a Lua script every frame in the shared interpreter.
+ *
+ * Unlike the engine LuaScriptComponent, which opens an interpreter per
+ * object, every LuaScript runs in LuaVM::getInstance(): the script is
+ * compiled once for all the objects using it and each object only costs an
+ * environment table. The script sees the same bindings as with the engine
+ * component: the start flag and the transform, rigidbody and text tables of
+ * the components its object has. Values the script changes are written back
+ * after each run. The script is the "Script" field of the component data,
+ * so any object can run any Lua file without a C++ class of its own.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class LuaScript final : public CPPMonoBehaviour {
+public:
+    /**
+     * @brief Constructor for the LuaScript class.
+     * @param owner Pointer to the owner object.
+     * @param data JSON data holding the "Script" path.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    LuaScript(IObject *owner, const json::IJsonObject *data);
+
+    /**
+     * @brief Default destructor for the LuaScript class.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~LuaScript() override = default;
+
+    /**
+     * @brief Compiles the script if no object did yet and creates the environment of this one.
+     * @throw std::runtime_error If no script is set or it cannot be compiled.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void start() override;
+
+    /**
+     * @brief Runs the script once, stopping for good after an error.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void update() override;
+
+    /**
+     * @brief Clones the component.
+     * @param owner The owner of the new component.
+     * @return A new LuaScript running the same script, sharing its compiled chunk.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    IComponent *clone(IObject *owner) const override;
+
+    /**
+     * @brief Reads the script path from the "Script" field, keeping the current one if it is missing.
+     * @param data JSON data for deserialization.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void deserialize(const json::IJsonObject *data) override;
+
+    /**
+     * @brief Releases the environment of this object.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void end() override;
+
+    /**
+     * @brief Serializes the component data into JSON format.
+     * @return Serialized JSON data.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    json::IJsonObject *serializeData() const override;
+
+    /**
+     * @brief Gets the script this component runs.
+     * @return Path of the Lua file.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const std::string &getScriptPath() const { return scriptPath; }
+
+private:
+    /**
+     * @brief Copies the component values into the binding tables.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void pushBindings();
+
+    /**
+     * @brief Applies the binding values the script changed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void pullBindings();
+
+    std::string scriptPath; ///< Lua file to run
+    int chunk = LuaVM::NO_REFERENCE; ///< Compiled script, shared with the other objects
+    int environment = LuaVM::NO_REFERENCE; ///< Globals of this object
+    bool firstRun = true; ///< Value of the start flag on the next run
+    bool failed = false; ///< The script raised an error
+    glm::vec3 pushedPosition {0}; ///< Transform position given to the script
+    glm::vec3 pushedVelocity {0}; ///< Rigidbody velocity given to the script
+    glm::vec3 pushedAcceleration {0}; ///< Rigidbody acceleration given to the script
+    glm::vec3 pushedColor {0}; ///< Text color given to the script
+};
+
+#endif // STELLARFORGE_LUASCRIPT_HPP
@@ -6,10 +6,38 @@
 */
 
 #include "Pipes.hpp"
+#include <stdexcept>
 #include "StellarForge/Graphics/components/Sprite.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include "src/sim/Simulation.hpp"
+#include "src/sim/SimulationClock.hpp"
+#include "src/state/GameState.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+#include "src/telemetry/Telemetry.hpp"
 
 using Vector3 = glm::vec3;
 
+namespace {
+    // The pair sprite starts PIPE_HEIGHT above the gap, its lower pipe ends PIPE_HEIGHT below it.
+    float pairTop(const float gapCentre, const float gapHeight)
+    {
+        return gapCentre - gapHeight / 2 - GameRules::PIPE_HEIGHT;
+    }
+
+    // ObjectManager calls go through these so the hitch watchdog can count them.
+    IObject *lookup(const UUID &uuid)
+    {
+        HitchWatchdog::getInstance().countObject(ObjectActivity::LOOKUP);
+        return ObjectManager::getInstance().getObjectById(uuid);
+    }
+
+    void commit(const UUID &uuid, IObject *object)
+    {
+        HitchWatchdog::getInstance().countObject(ObjectActivity::UPDATE);
+        ObjectManager::getInstance().updateObject(uuid, object);
+    }
+}
+
 Pipes::Pipes(IObject *owner, const json::IJsonObject *data)
     : CPPMonoBehaviour(owner)
 {
@@ -18,73 +46,142 @@ Pipes::Pipes(IObject *owner, const json::IJsonObject *data)
 void Pipes::onGameLost(const EventData& data)
 {
     gameLost = true;
-    for (auto &pipe : pipes) {
-        ObjectManager::getInstance().removeObject(pipe);
+    clearPipes();
+}
+
+void Pipes::clearPipes()
+{
+    while (!pipes.empty()) {
+        releasePipe(pipes.size() - 1);
     }
 }
 
 
 void Pipes::start()
 {
-    startTime = std::chrono::system_clock::now();
-    actualTime = std::chrono::system_clock::now();
-    EventSystem::getInstance().registerListener("bird_died", [this](const EventData& data) {
+    elapsed = 0;
+    gapHeight = Simulation::configuredPipeGap();
+    // Pipes are recycled rather than duplicated so spawning does not allocate during play.
+    pipes.reserve(GameSnapshot::MAX_PIPES);
+    bodies.reserve(TRANSFORM | RIGIDBODY, GameSnapshot::MAX_PIPES);
+    idlePipes.reserve(POOL_SIZE);
+    while (idlePipes.size() < POOL_SIZE) {
+        idlePipes.push_back(makePipe());
+    }
+    listeners.listen("bird_died", [this](const EventData& data) {
         onGameLost(data);
     });
+    GameState::getInstance().registerParticipant(this);
 }
 
-void Pipes::spawnPipe(float offset)
+void Pipes::spawnPipe(float offset, const float age)
+{
+    createPipe(GameRules::PIPE_SPAWN_X - speed * age, GameRules::PIPE_GAP_CENTRE + offset, gapHeight);
+}
+
+UUID Pipes::makePipe()
 {
     UUID baseUuid;
     baseUuid.setUuidFromString("9a24f7e2-edbb-4e54-a5dc-944454c8c1fd");
+    HitchWatchdog::getInstance().countObject(ObjectActivity::DUPLICATE);
     UUID const uuid = ObjectManager::getInstance().duplicateObject(baseUuid);
-    pipes.push_back(uuid);
-    IObject *pipe = ObjectManager::getInstance().getObjectById(uuid);
+    IObject *pipe = lookup(uuid);
+    if (pipe == nullptr) {
+        return uuid;
+    }
+    // The object only draws the pair: bodies moves it and Simulation collides its gap, so it has no rigidbody or box.
+    pipe->setActive(false);
+    commit(uuid, pipe);
+    return uuid;
+}
+
+void Pipes::createPipe(const float x, const float gapCentre, const float gap)
+{
+    if (idlePipes.empty()) {
+        // Duplicating an object mid-game would allocate, and a snapshot could not hold the extra pair anyway.
+        throw std::runtime_error("Pipes: all " + std::to_string(POOL_SIZE) + " pooled pipe pairs are live");
+    }
+    UUID const uuid = idlePipes.back();
+    idlePipes.pop_back();
+    const Float3 position {x, pairTop(gapCentre, gap), 1};
+    const Entity entity = bodies.create(TRANSFORM | RIGIDBODY);
+    bodies.transform(entity).setPosition(position);
+    bodies.rigidBody(entity).setVelocity({-speed, 0, 0});
+    IObject *pipe = lookup(uuid);
+    // The Transform is looked up once per spawn, update writes through the cached pointer.
+    auto *transform = pipe != nullptr ? pipe->getComponent<Transform>() : nullptr;
+    pipes.push_back({uuid, entity, transform, position, gapCentre, gap});
     if (pipe == nullptr) {
         return;
     }
+    transform->setPosition(Vector3(position.x, position.y, position.z));
     pipe->setActive(true);
-    ObjectManager::getInstance().updateObject(uuid, pipe);
-    auto *transform = pipe->getComponent<Transform>();
-    auto *rigidbody = pipe->getComponent<RigidBody>();
-    rigidbody->_velocity = Vector3(-speed, 0, 0);
-    rigidbody->_acceleration = Vector3(0, 0, 0);
-    rigidbody->_terminalVelocity = 0;
-    rigidbody->_drag = 0;
-    if (500 + offset > 0) {
-        transform->rotate2D(180);
-        rigidbody->_collider->scale(-1);
-        transform->setPosition(Vector3(2000 + 140, 500 + offset + 890, 1));
-    } else {
-        transform->setPosition(Vector3(2000, 500 + offset, 1));
+    commit(uuid, pipe);
+}
+
+void Pipes::releasePipe(const std::size_t index)
+{
+    const SpawnedPipe pipe = pipes[index];
+    pipes.erase(pipes.begin() + static_cast<std::ptrdiff_t>(index));
+    bodies.destroy(pipe.entity);
+    if (IObject *object = lookup(pipe.uuid); object != nullptr) {
+        object->setActive(false);
+        commit(pipe.uuid, object);
     }
+    idlePipes.push_back(pipe.uuid);
 }
 
 void Pipes::update()
 {
-    actualTime = std::chrono::system_clock::now();
-    if (std::chrono::duration<float, std::chrono::seconds::period>(actualTime - startTime).count() >= spawnRate && !gameLost) {
-        // Spawn pipes
-        startTime = actualTime;
-        const int offset = (rand() % 400) - 200;
-        spawnPipe(static_cast<float>(offset - 150 - 890));
-        spawnPipe(static_cast<float>(offset + 150));
+    ALLOCATION_SCOPE("Pipes");
+    FRAME_SECTION("Pipes");
+    const auto &clock = SimulationClock::getInstance();
+    for (unsigned i = 0; i < clock.getSteps(); i++) {
+        step(clock.getStep());
     }
+    const float alpha = clock.getAlpha();
     for (auto &pipe : pipes) {
-        const auto *object = ObjectManager::getInstance().getObjectById(pipe);
-        if (object == nullptr) {
+        if (pipe.transform == nullptr) {
             continue;
         }
-        if (auto *transform = object->getComponent<Transform>(); transform->getPosition().x < -200) {
-            ObjectManager::getInstance().removeObject(pipe);
-            pipes.erase(std::remove(pipes.begin(), pipes.end(), pipe), pipes.end());
+        const Float3 position = bodies.transform(pipe.entity).interpolate(alpha);
+        if (position.x != pipe.presented.x || position.y != pipe.presented.y || position.z != pipe.presented.z) {
+            pipe.transform->setPosition(Vector3(position.x, position.y, position.z));
+            pipe.presented = position;
         }
     }
 }
 
+void Pipes::step(const float step)
+{
+    bodies.integrate(step);
+    for (std::size_t i = 0; i < pipes.size();) {
+        if (bodies.transform(pipes[i].entity).getPosition().x < GameRules::PIPE_RETIRE_X) {
+            releasePipe(i);
+            Telemetry::getInstance().addPipeRetired();
+            HitchWatchdog::getInstance().recordEvent(HitchEvent::PIPE_RETIRED);
+            continue;
+        }
+        i++;
+    }
+    if (gameLost) {
+        return;
+    }
+    std::uint32_t rngState = random.getState();
+    Simulation::runSpawner(elapsed, spawnRate, rngState, step, [this](const float offset, const float age) {
+        spawnPipe(offset, age);
+        Telemetry::getInstance().addPipesSpawned(1);
+        HitchWatchdog::getInstance().recordEvent(HitchEvent::PIPE_SPAWNED);
+    });
+    random.setState(rngState);
+}
+
 void Pipes::setSpeed(const float newSpeed)
 {
     speed = newSpeed;
+    for (const auto &pipe : pipes) {
+        bodies.rigidBody(pipe.entity).setVelocity({-speed, 0, 0});
+    }
 }
 
 float Pipes::getSpeed() const
@@ -102,11 +199,17 @@ float Pipes::getSpawnRate() const
     return spawnRate;
 }
 
+float Pipes::getGapHeight() const
+{
+    return gapHeight;
+}
+
 IComponent *Pipes::clone(IObject *owner) const
 {
     auto *comp = new Pipes(owner, nullptr);
     comp->speed = speed;
     comp->spawnRate = spawnRate;
+    comp->gapHeight = gapHeight;
     return comp;
 }
 
@@ -116,9 +219,44 @@ void Pipes::deserialize(const json::IJsonObject *data)
 
 void Pipes::end()
 {
+    listeners.clear();
+    GameState::getInstance().unregisterParticipant(this);
 }
 
 json::IJsonObject *Pipes::serializeData() const
 {
     return nullptr;
 }
+
+void Pipes::saveState(GameSnapshot &snapshot)
+{
+    for (const auto &pipe : pipes) {
+        if (snapshot.pipeCount >= GameSnapshot::MAX_PIPES) {
+            break;
+        }
+        snapshot.pipes[snapshot.pipeCount++] = {bodies.transform(pipe.entity).getPosition().x, pipe.gapCentre, pipe.gapHeight};
+    }
+    snapshot.pipeTimer = elapsed;
+    snapshot.pipeSpeed = speed;
+    snapshot.pipeGap = gapHeight;
+    snapshot.rngState = random.getState();
+}
+
+void Pipes::loadState(const GameSnapshot &snapshot)
+{
+    clearPipes();
+    speed = snapshot.pipeSpeed;
+    for (std::size_t i = 0; i < snapshot.pipeCount; i++) {
+        createPipe(snapshot.pipes[i].x, snapshot.pipes[i].gapCentre, snapshot.pipes[i].gapHeight);
+    }
+    random.setState(snapshot.rngState);
+    elapsed = snapshot.pipeTimer;
+    gameLost = snapshot.gameOver;
+}
+
+void Pipes::resetState()
+{
+    clearPipes();
+    elapsed = 0;
+    gameLost = false;
+}
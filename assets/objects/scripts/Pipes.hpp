@@ -8,7 +8,6 @@
 #ifndef STELLARFORGE_PIPES_HPP
 #define STELLARFORGE_PIPES_HPP
 
-#include <chrono>
 #include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
 #include "StellarForge/Common/components/Transform.hpp"
 #include "StellarForge/Physics/components/RigidBody.hpp"
@@ -16,6 +15,11 @@
 #include "StellarForge/Common/event/EventSystem.hpp"
 #include "StellarForge/Common/managers/ObjectManager.hpp"
 #include "StellarForge/Physics/Box.hpp"
+#include "src/ecs/ArchetypeStorage.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/events/ListenerScope.hpp"
+#include "src/state/ISnapshotable.hpp"
+#include "src/utils/Random.hpp"
 
 /**
  * @class Pipes
@@ -24,8 +28,10 @@
  * @since v0.1.0
  * @author Landry Gigant
  */
-class Pipes : public CPPMonoBehaviour {
+class Pipes : public CPPMonoBehaviour, public ISnapshotable {
 public:
+    static constexpr std::size_t POOL_SIZE = GameSnapshot::MAX_PIPES; ///< Pipe pair objects created up front, as many as a snapshot holds
+
     /**
      * @brief Constructor for the Pipes class.
      * @param owner Pointer to the owner object.
@@ -53,7 +59,7 @@ public:
     void start() override;
 
     /**
-     * @brief Updates the pipes' position and state every frame.
+     * @brief Runs the fixed simulation steps due on this frame and presents the interpolated pipes.
      * @version v0.1.0
      * @since v0.1.0
      * @authors Landry Gigant & Aubane Nourry
@@ -97,13 +103,46 @@ public:
     [[nodiscard]] float getSpawnRate() const;
 
     /**
-     * @brief Spawns a pipe with a specified offset.
-     * @param offset The offset for spawning the pipe.
+     * @brief Gets the height of the gap between the two pipes of a pair.
+     *
+     * Fixed for the run by Simulation::configuredPipeGap, since the pair
+     * texture the engine draws is built for it before the scene loads.
+     * @return The gap height.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float getGapHeight() const;
+
+    /**
+     * @brief Spawns a pipe pair with a specified offset.
+     * @param offset Offset of the gap centre from GameRules::PIPE_GAP_CENTRE.
+     * @param age Seconds the pair has already travelled since its spawn time.
      * @version v0.1.0
      * @since v0.1.0
      * @authors Landry Gigant & Aubane Nourry
      */
-    void spawnPipe(float offset);
+    void spawnPipe(float offset, float age = 0);
+
+    /**
+     * @brief Activates a pooled pipe pair object at an exact position.
+     * @param x Left edge of the pair.
+     * @param gapCentre Vertical centre of the gap.
+     * @param gap Height of the gap.
+     * @throw std::runtime_error If every pooled pair is already live.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void createPipe(float x, float gapCentre, float gap);
+
+    /**
+     * @brief Returns every live pipe to the pool.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void clearPipes();
 
     /**
      * @brief Event handler for when the game is lost.
@@ -150,18 +189,85 @@ public:
      */
     json::IJsonObject *serializeData() const override;
 
+    /**
+     * @brief Copies the live pipes, spawn timer and course generator into a snapshot.
+     * @param snapshot Snapshot to fill.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void saveState(GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Puts the pipes back in the state recorded in a snapshot.
+     * @param snapshot Snapshot to restore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void loadState(const GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Returns every pipe to the pool and restarts the spawn timer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void resetState() override;
+
 private:
-    float speed = 300.0f; ///< Speed of the pipes' movement
-    float spawnRate = 2.00f; ///< Rate at which pipes spawn
-    #ifdef _WIN32
-     std::chrono::steady_clock::time_point startTime;
-     std::chrono::steady_clock::time_point actualTime;
-    #else
-     std::chrono::system_clock::time_point startTime;
-     std::chrono::system_clock::time_point actualTime;
-    #endif // _WIN32
-    std::vector<UUID> pipes; ///< List of pipes spawned
+    /**
+     * @brief Spawns, moves and retires the pipes for one simulation step.
+     * @param step Duration of the step in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void step(float step);
+
+    /**
+     * @brief Duplicates the pipe pair template into a new inactive object.
+     * @return The UUID of the new object.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static UUID makePipe();
+
+    /**
+     * @brief Deactivates a live pipe and returns it to the pool.
+     * @param index Index of the pipe in the live pipes.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void releasePipe(std::size_t index);
+
+    float speed = GameRules::PIPE_SPEED; ///< Speed of the pipes' movement
+    float spawnRate = GameRules::PIPE_SPAWN_RATE; ///< Rate at which pipes spawn
+    float gapHeight = GameRules::PIPE_GAP; ///< Height of the gap of the pairs spawned, set in start
+    float elapsed = 0; ///< Simulated seconds since the last spawn
+    /**
+     * @struct SpawnedPipe
+     * @brief A live pipe pair, its simulated body and its gap.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct SpawnedPipe {
+        UUID uuid; ///< Object of the pair
+        Entity entity; ///< Simulated position and velocity of the pair in bodies
+        Transform *transform; ///< Transform of the pair object, null if the object is missing
+        Float3 presented; ///< Position last written to the transform
+        float gapCentre; ///< Vertical centre of the gap
+        float gapHeight; ///< Height of the gap
+    };
+    std::vector<SpawnedPipe> pipes; ///< List of pipe pairs spawned
+    ArchetypeStorage bodies; ///< Transforms and rigidbodies of the live pairs, integrated together each step
+    std::vector<UUID> idlePipes; ///< Inactive pipe pair objects
+    Random random; ///< Generator of the pipe course
     bool gameLost = false; ///< Indicates if the game is lost
+    ListenerScope listeners; ///< Game-over listener, removed in end()
 };
 
 #endif // STELLARFORGE_PIPES_HPP
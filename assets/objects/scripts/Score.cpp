@@ -6,35 +6,67 @@
 */
 
 #include "Score.hpp"
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include "src/audit/AllocationAudit.hpp"
+#include "src/leaderboard/Leaderboard.hpp"
+#include "src/sim/Simulation.hpp"
+#include "src/sim/SimulationClock.hpp"
+#include "src/state/GameState.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+#include "src/telemetry/Telemetry.hpp"
 
 using Vector3 = glm::vec3;
 
 Score::Score(IObject *owner, const json::IJsonObject *data) : CPPMonoBehaviour(owner) {}
 
 void Score::onGameLost(const EventData &data) {
-    auto *text = getParentComponent<UIText>();
-    text->setText("Game Over! Your score is " + std::to_string(score));
-    auto *transform = getParentComponent<Transform>();
-    auto *sfText = text->getText();
-    sf::FloatRect const getLocalBounds = sfText->getLocalBounds();
-    sfText->setOrigin(getLocalBounds.width / 2, 0);
-    transform->setPosition(Vector3(1920 / 2, 100, 20));
     gameLost = true;
+    setUITextScore();
+    // A rewind revives the bird, so only the first death of the session reaches the leaderboard.
+    if (submitted) {
+        return;
+    }
+    submitted = true;
+    const auto &state = GameState::getInstance();
+    ScoreRecord record;
+    record.score = score;
+    record.seed = state.getCourseSeed();
+    record.durationMs = static_cast<std::uint32_t>(std::lround(static_cast<double>(state.getTick()) * SimulationClock::getInstance().getStep() * 1000));
+    record.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    Leaderboard::getInstance().submit(record);
 }
 
 void Score::start() {
-    startTime = std::chrono::high_resolution_clock::now();
-    actualTime = std::chrono::high_resolution_clock::now();
+    elapsed = 0;
     score = 0;
+    scoreText.reserve(SCORE_TEXT_RESERVE);
     setUITextScore();
-    EventSystem::getInstance().registerListener("bird_died", [this](const EventData& data) {
+    listeners.listen("bird_died", [this](const EventData& data) {
             onGameLost(data);
         });
+    GameState::getInstance().registerParticipant(this);
 }
 
 void Score::setUITextScore() {
+    // The UIText re-lays its glyphs on every setText, only hand it a text that changed.
+    if (textShown && score == shownScore && gameLost == shownGameLost) {
+        return;
+    }
+    textShown = true;
+    shownScore = score;
+    shownGameLost = gameLost;
+    char digits[16];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), score);
+    scoreText.assign(gameLost ? GAME_OVER_TEXT : "");
+    scoreText.append(digits, result.ptr);
+    setUIText(scoreText);
+}
+
+void Score::setUIText(const std::string &value) {
     auto *text = getParentComponent<UIText>();
-    text->setText(std::to_string(score));
+    text->setText(value);
     auto *transform = getParentComponent<Transform>();
     auto *sfText = text->getText();
     sf::FloatRect const getLocalBounds = sfText->getLocalBounds();
@@ -43,12 +75,15 @@ void Score::setUITextScore() {
 }
 
 void Score::update() {
-    actualTime = std::chrono::system_clock::now();
-    if (std::chrono::duration<float>(actualTime - startTime).count() >= timeBeforePipe && !gameLost) {
-        startTime = actualTime;
-        score++;
-        setUITextScore();
-        timeBeforePipe = 2.0f;
+    ALLOCATION_SCOPE("Score");
+    FRAME_SECTION("Score");
+    const auto &clock = SimulationClock::getInstance();
+    for (unsigned i = 0; i < clock.getSteps() && !gameLost; i++) {
+        if (const unsigned points = Simulation::runScoreTimer(elapsed, timeBeforePipe, clock.getStep()); points > 0) {
+            score += points;
+            Telemetry::getInstance().setScore(score);
+            setUITextScore();
+        }
     }
 }
 
@@ -60,8 +95,36 @@ IComponent *Score::clone (IObject *owner) const {
 
 void Score::deserialize(const json::IJsonObject *data) {}
 
-void Score::end() {}
+void Score::end() {
+    listeners.clear();
+    GameState::getInstance().unregisterParticipant(this);
+}
 
 json::IJsonObject *Score::serializeData() const {
     return nullptr;
 }
+
+void Score::saveState(GameSnapshot &snapshot) {
+    snapshot.score = score;
+    snapshot.scoreTimer = elapsed;
+    snapshot.scoreDelay = timeBeforePipe;
+    snapshot.gameOver = gameLost;
+}
+
+void Score::loadState(const GameSnapshot &snapshot) {
+    score = snapshot.score;
+    timeBeforePipe = snapshot.scoreDelay;
+    elapsed = snapshot.scoreTimer;
+    gameLost = snapshot.gameOver;
+    setUITextScore();
+}
+
+void Score::resetState() {
+    score = 0;
+    elapsed = 0;
+    timeBeforePipe = GameRules::SCORE_FIRST_DELAY;
+    gameLost = false;
+    submitted = false;
+    Telemetry::getInstance().setScore(score);
+    setUITextScore();
+}
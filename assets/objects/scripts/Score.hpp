@@ -8,12 +8,15 @@
 #ifndef SCORE_HPP
 #define SCORE_HPP
 
-#include <chrono>
+#include <cstddef>
 #include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
 #include "StellarForge/Common/components/Transform.hpp"
 #include "StellarForge/Graphics/components/UIText.hpp"
 #include "StellarForge/Common/json/JsonObject.hpp"
 #include "StellarForge/Common/event/EventSystem.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/events/ListenerScope.hpp"
+#include "src/state/ISnapshotable.hpp"
 
 /**
  * @class Score
@@ -22,8 +25,11 @@
  * @since v0.1.0
  * @author Aubane Nourry
  */
-class Score final : public CPPMonoBehaviour {
+class Score final : public CPPMonoBehaviour, public ISnapshotable {
 public:
+    static constexpr const char *GAME_OVER_TEXT = "Game Over! Your score is "; ///< Shown before the final score
+    static constexpr std::size_t SCORE_TEXT_RESERVE = 48; ///< Room for the game-over text and any score
+
     /**
      * @brief Constructor for the Score class.
      * @param owner Pointer to the owner object.
@@ -59,7 +65,10 @@ public:
     void update() override;
 
     /**
-     * @brief Updates the UI score text.
+     * @brief Updates the UI score text, with the game-over message once the game is lost.
+     *
+     * Does nothing while the shown score and game-over state are unchanged, so
+     * a restore or a reset to the same score does not rebuild the text.
      * @version v0.1.0
      * @since v0.1.0
      * @author Aubane Nourry
@@ -67,7 +76,7 @@ public:
     void setUITextScore();
 
     /**
-     * @brief Event handler for when the game is lost.
+     * @brief Event handler for when the game is lost, submits the result to the Leaderboard.
      * @param data Event data for game loss.
      * @version v0.1.0
      * @since v0.1.0
@@ -129,17 +138,52 @@ public:
      */
     json::IJsonObject *serializeData() const override;
 
+    /**
+     * @brief Copies the score, score timer and game-over flag into a snapshot.
+     * @param snapshot Snapshot to fill.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void saveState(GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Puts the score back in the state recorded in a snapshot.
+     * @param snapshot Snapshot to restore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void loadState(const GameSnapshot &snapshot) override;
+
+    /**
+     * @brief Zeroes the score and its timer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void resetState() override;
+
 private:
-    #ifdef _WIN32
-     std::chrono::steady_clock::time_point startTime;
-     std::chrono::steady_clock::time_point actualTime;
-    #else
-     std::chrono::system_clock::time_point startTime;
-     std::chrono::system_clock::time_point actualTime;
-    #endif // _WIN32
+    /**
+     * @brief Sets the UI text and centers it at the top of the screen.
+     * @param value Text to display.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setUIText(const std::string &value);
+
+    float elapsed = 0; ///< Simulated seconds since the last score increment
+    std::string scoreText; ///< Reused buffer of the displayed score
+    bool textShown = false; ///< scoreText has been given to the UIText
+    unsigned int shownScore = 0; ///< Score in the displayed text
+    bool shownGameLost = false; ///< The displayed text is the game-over one
     unsigned int score = 0; ///< Current game score
-    float timeBeforePipe = 8.5f; ///< Time before next pipe spawns
+    float timeBeforePipe = GameRules::SCORE_FIRST_DELAY; ///< Time before next pipe spawns
     bool gameLost = false; ///< Indicates if the game is lost
+    bool submitted = false; ///< The result of this session went to the leaderboard, cleared by a restart only
+    ListenerScope listeners; ///< Game-over listener, removed in end()
 };
 
 #endif // SCORE_HPP
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorFeed.cpp
+*/
+
+#include "SpectatorFeed.hpp"
+#include <cstdlib>
+#include "src/audit/AllocationAudit.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/state/GameState.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+
+SpectatorFeed::SpectatorFeed(IObject *owner, const json::IJsonObject *data)
+    : CPPMonoBehaviour(owner), encoder(SAMPLE_RATE, KEYFRAME_INTERVAL, GameRules::PIPE_SPEED) {}
+
+void SpectatorFeed::start() {
+    const char *target = std::getenv("FLAPPY_SPECTATOR");
+    if (target == nullptr || *target == '\0') {
+        return;
+    }
+    try {
+        sink = std::make_unique<SpectatorSink>(target);
+    } catch (const std::exception &e) {
+        this->_log.info << std::string("Spectator feed disabled: ") + e.what() + "\n";
+        return;
+    }
+    buffer.reserve(1024);
+    encoder.writeHeader(buffer);
+    sink->write(buffer.data(), buffer.size());
+    buffer.clear();
+    nextSample = std::chrono::steady_clock::now();
+}
+
+void SpectatorFeed::update() {
+    ALLOCATION_SCOPE("SpectatorFeed");
+    FRAME_SECTION("SpectatorFeed");
+    if (!sink) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const auto period = std::chrono::microseconds(1000000 / SAMPLE_RATE);
+    if (now < nextSample) {
+        return;
+    }
+    // Sample once even if several periods elapsed, the next keyframe catches up.
+    nextSample = std::max(nextSample + period, now);
+    GameState::getInstance().capture(snapshot);
+    snapshot.tick = samples++;
+    encoder.encode(snapshot, buffer);
+    if (!sink->write(buffer.data(), buffer.size())) {
+        this->_log.info << std::string("Spectator feed closed\n");
+        sink.reset();
+    }
+    buffer.clear();
+}
+
+IComponent *SpectatorFeed::clone(IObject *owner) const {
+    return new SpectatorFeed(owner, nullptr);
+}
+
+void SpectatorFeed::deserialize(const json::IJsonObject *data) {}
+
+void SpectatorFeed::end() {
+    sink.reset();
+}
+
+json::IJsonObject *SpectatorFeed::serializeData() const {
+    return nullptr;
+}
@@ -0,0 +1,115 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorFeed.hpp
+*/
+
+#ifndef SPECTATORFEED_HPP
+#define SPECTATORFEED_HPP
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
+#include "StellarForge/Common/json/JsonObject.hpp"
+#include "StellarForge/Common/utils/Logger.hpp"
+#include "src/spectator/SpectatorEncoder.hpp"
+#include "src/spectator/SpectatorSink.hpp"
+
+/**
+ * @class SpectatorFeed
+ * @brief Streams the play state to spectators at a fixed sample rate.
+ *
+ * Idle unless the FLAPPY_SPECTATOR environment variable names a file or a
+ * "unix:<path>" socket to write the stream to.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SpectatorFeed final : public CPPMonoBehaviour {
+public:
+    static constexpr std::uint32_t SAMPLE_RATE = 30; ///< Records per second
+    static constexpr std::uint32_t KEYFRAME_INTERVAL = SAMPLE_RATE * 2; ///< Records between two keyframes
+
+    /**
+     * @brief Constructor for the SpectatorFeed class.
+     * @param owner Pointer to the owner object.
+     * @param data JSON data for configuration.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    SpectatorFeed(IObject *owner, const json::IJsonObject *data);
+
+    /**
+     * @brief Default destructor for the SpectatorFeed class.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~SpectatorFeed() override = default;
+
+    /**
+     * @brief Opens the stream named by FLAPPY_SPECTATOR, if any.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void start() override;
+
+    /**
+     * @brief Writes one record per elapsed sample period.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void update() override;
+
+    /**
+     * @brief Clones the spectator feed component.
+     * @param owner The owner of the new component.
+     * @return A new SpectatorFeed component clone.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    IComponent *clone(IObject *owner) const override;
+
+    /**
+     * @brief Deserializes spectator feed data from JSON.
+     * @param data JSON data for deserialization.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void deserialize(const json::IJsonObject *data) override;
+
+    /**
+     * @brief Closes the stream.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void end() override;
+
+    /**
+     * @brief Serializes the spectator feed data into JSON format.
+     * @return Serialized JSON data.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    json::IJsonObject *serializeData() const override;
+
+private:
+    Logger _log;
+    std::unique_ptr<SpectatorSink> sink; ///< Stream destination, null when idle
+    SpectatorEncoder encoder; ///< Record encoder
+    std::vector<std::uint8_t> buffer; ///< Reused output buffer
+    GameSnapshot snapshot; ///< Reused capture buffer
+    std::uint32_t samples = 0; ///< Records written so far
+    std::chrono::steady_clock::time_point nextSample; ///< Time of the next record
+};
+
+#endif // SPECTATORFEED_HPP
@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** StateRecorder.cpp
+*/
+
+#include "StateRecorder.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include "src/sim/SimulationClock.hpp"
+#include "src/state/GameState.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+#include "src/telemetry/Telemetry.hpp"
+
+StateRecorder::StateRecorder(IObject *owner, const json::IJsonObject *data) : CPPMonoBehaviour(owner) {}
+
+void StateRecorder::start() {
+    listeners.listen("r_pressed", [this](const EventData& data) {
+        rewindRequested = true;
+    });
+    listeners.listen("space_pressed", [this](const EventData& data) {
+        restartRequested = true;
+    });
+    listeners.listen("z_pressed", [this](const EventData& data) {
+        restartRequested = true;
+    });
+    listeners.listen("bird_died", [this](const EventData& data) {
+        deathTick = GameState::getInstance().getTick();
+    });
+}
+
+void StateRecorder::update() {
+    record();
+    if (restartPending) {
+        // Restarted once the audited scope is closed: ending the telemetry session formats text and writes files.
+        restartPending = false;
+        restart();
+    }
+}
+
+void StateRecorder::record() {
+    ALLOCATION_SCOPE("StateRecorder");
+    FRAME_SECTION("StateRecorder");
+    if (rewindRequested) {
+        rewindRequested = false;
+        rewind(RETRY_TICKS);
+        return;
+    }
+    if (restartRequested) {
+        restartRequested = false;
+        // Jumps are only a restart once the bird has been dead for a moment, the bird handles them otherwise.
+        if (deathTick >= 0 && static_cast<std::int64_t>(GameState::getInstance().getTick()) - deathTick >= static_cast<std::int64_t>(RESTART_DELAY_TICKS)) {
+            restartPending = true;
+            return;
+        }
+    }
+    if (const unsigned steps = SimulationClock::getInstance().getSteps(); steps > 0) {
+        GameState::getInstance().recordTick(steps);
+    }
+}
+
+void StateRecorder::rewind(const std::size_t ticks) {
+    auto &state = GameState::getInstance();
+    if (!state.rewind(ticks)) {
+        return;
+    }
+    // A rewind that lands after the death keeps the bird dead, the restart delay counts again from there.
+    const GameSnapshot *restored = state.getHistory().at(0);
+    deathTick = restored != nullptr && restored->birdDead ? static_cast<std::int64_t>(state.getTick()) : -1;
+}
+
+void StateRecorder::restart() {
+    auto &telemetry = Telemetry::getInstance();
+    telemetry.endSession();
+    telemetry.beginSession();
+    ALLOCATION_SCOPE("StateRecorder");
+    GameState::getInstance().reset();
+    deathTick = -1;
+}
+
+IComponent *StateRecorder::clone(IObject *owner) const {
+    return new StateRecorder(owner, nullptr);
+}
+
+void StateRecorder::deserialize(const json::IJsonObject *data) {}
+
+void StateRecorder::end() {
+    listeners.clear();
+}
+
+json::IJsonObject *StateRecorder::serializeData() const {
+    return nullptr;
+}
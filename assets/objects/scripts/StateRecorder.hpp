@@ -0,0 +1,134 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** StateRecorder.hpp
+*/
+
+#ifndef STATERECORDER_HPP
+#define STATERECORDER_HPP
+
+#include <cstdint>
+#include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
+#include "StellarForge/Common/json/JsonObject.hpp"
+#include "StellarForge/Common/event/EventSystem.hpp"
+#include "src/events/ListenerScope.hpp"
+
+/**
+ * @class StateRecorder
+ * @brief Records a snapshot of the play state after every simulated frame, rewinds it and restarts the game on demand.
+ *
+ * A jump input shortly after the bird died starts a new game in place.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class StateRecorder final : public CPPMonoBehaviour {
+public:
+    static constexpr std::size_t RETRY_TICKS = 120; ///< Ticks rewound by a retry (2 s at 60 Hz)
+    static constexpr std::size_t RESTART_DELAY_TICKS = 30; ///< Ticks the bird stays dead before a jump restarts
+
+    /**
+     * @brief Constructor for the StateRecorder class.
+     * @param owner Pointer to the owner object.
+     * @param data JSON data for configuration.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    StateRecorder(IObject *owner, const json::IJsonObject *data);
+
+    /**
+     * @brief Default destructor for the StateRecorder class.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~StateRecorder() override = default;
+
+    /**
+     * @brief Registers the retry and restart listeners.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void start() override;
+
+    /**
+     * @brief Records the play state once the steps of the frame ran, then applies a due restart.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void update() override;
+
+    /**
+     * @brief Rewinds the play state to a checkpoint a few ticks back.
+     * @param ticks Number of ticks to go back.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void rewind(std::size_t ticks);
+
+    /**
+     * @brief Starts a new game without reloading the scene and opens a new telemetry session.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void restart();
+
+    /**
+     * @brief Clones the state recorder component.
+     * @param owner The owner of the new component.
+     * @return A new StateRecorder component clone.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    IComponent *clone(IObject *owner) const override;
+
+    /**
+     * @brief Deserializes state recorder data from JSON.
+     * @param data JSON data for deserialization.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void deserialize(const json::IJsonObject *data) override;
+
+    /**
+     * @brief Called when the state recorder component is destroyed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void end() override;
+
+    /**
+     * @brief Serializes the state recorder data into JSON format.
+     * @return Serialized JSON data.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    json::IJsonObject *serializeData() const override;
+
+private:
+    /**
+     * @brief Applies a requested retry, or records the play state once the steps of the frame ran.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void record();
+
+    bool rewindRequested = false; ///< A retry was requested during this tick
+    bool restartRequested = false; ///< A jump input arrived during this tick
+    bool restartPending = false; ///< A restart is due once the audited part of update is done
+    std::int64_t deathTick = -1; ///< Tick the bird died on, -1 while it is alive
+    ListenerScope listeners; ///< Input listeners, removed in end()
+};
+
+#endif // STATERECORDER_HPP
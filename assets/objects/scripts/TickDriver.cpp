@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** TickDriver.cpp
+*/
+
+#include "TickDriver.hpp"
+#include <cstdlib>
+#include <sstream>
+#include "src/audit/AllocationAudit.hpp"
+#include "src/plugins/PluginLoader.hpp"
+#include "src/sim/SimulationClock.hpp"
+#include "src/telemetry/HitchWatchdog.hpp"
+#include "src/telemetry/Telemetry.hpp"
+#include "src/utils/Startup.hpp"
+
+TickDriver::TickDriver(IObject *owner, const json::IJsonObject *data) : CPPMonoBehaviour(owner) {}
+
+void TickDriver::start() {
+    if (const char *rate = std::getenv("FLAPPY_TICK_RATE"); rate != nullptr && *rate != '\0') {
+        SimulationClock::getInstance().setTickRate(std::strtof(rate, nullptr));
+    }
+    if (const char *budget = std::getenv("FLAPPY_HITCH_BUDGET_MS"); budget != nullptr && *budget != '\0') {
+        HitchWatchdog::getInstance().setBudget(std::strtof(budget, nullptr) / 1000);
+    }
+    listeners.listen("space_pressed", [](const EventData &data) {
+        HitchWatchdog::getInstance().recordEvent(HitchEvent::JUMP);
+    });
+    listeners.listen("z_pressed", [](const EventData &data) {
+        HitchWatchdog::getInstance().recordEvent(HitchEvent::JUMP);
+    });
+    listeners.listen("bird_died", [](const EventData &data) {
+        HitchWatchdog::getInstance().recordEvent(HitchEvent::BIRD_DIED);
+    });
+#ifdef FLAPPY_ALLOCATION_AUDIT
+    if (const char *warmup = std::getenv("FLAPPY_AUDIT_WARMUP"); warmup != nullptr && *warmup != '\0') {
+        AllocationAudit::setWarmupFrames(std::strtoull(warmup, nullptr, 10));
+    }
+#endif // FLAPPY_ALLOCATION_AUDIT
+}
+
+void TickDriver::update() {
+    auto &clock = SimulationClock::getInstance();
+    {
+        ALLOCATION_SCOPE("TickDriver");
+        FRAME_SECTION("TickDriver");
+#ifdef FLAPPY_ALLOCATION_AUDIT
+        AllocationAudit::frame();
+#endif // FLAPPY_ALLOCATION_AUDIT
+        clock.beginFrame();
+        auto &telemetry = Telemetry::getInstance();
+        if (clock.getFrameTime() > 0) {
+            telemetry.recordFrame(clock.getFrameTime());
+        }
+        telemetry.addTicks(clock.getSteps());
+        if (firstFrame) {
+            firstFrame = false;
+            reportStartup();
+        }
+    }
+    // Outside the audited scope: the watchdog is not a gameplay component, and its hitch path stays allocation-free on its own.
+    if (clock.getFrameTime() > 0) {
+        HitchWatchdog::getInstance().endFrame(clock.getFrameTime(), clock.getTick());
+    }
+}
+
+void TickDriver::report() {
+    const auto &clock = SimulationClock::getInstance();
+    const FramePacingReport pacing = clock.getPacing().report();
+    if (pacing.samples == 0) {
+        return;
+    }
+    std::ostringstream line;
+    line << "Frame pacing over " << pacing.samples << " frames: mean " << pacing.mean * 1000
+        << " ms, jitter " << pacing.jitter * 1000 << " ms, p99 " << pacing.p99 * 1000
+        << " ms, max " << pacing.max * 1000 << " ms, tick " << clock.getTick()
+        << ", dropped steps " << clock.getDroppedSteps() << "\n";
+    const HitchWatchdog &watchdog = HitchWatchdog::getInstance();
+    const HitchStats &hitches = watchdog.getStats();
+    line << "Hitches over " << watchdog.getBudget() * 1000 << " ms: " << hitches.hitches << "/" << hitches.frames
+        << " frames, " << hitches.reports << " reported, " << hitches.suppressed << " within the cooldown\n";
+    this->_log.info << line.str();
+}
+
+void TickDriver::reportStartup() {
+    std::ostringstream line;
+    line << "First frame after " << Startup::millisecondsSinceLaunch() << " ms";
+    const PluginStats &plugins = PluginLoader::getInstance().getStats();
+    line << ", plugins " << plugins.opened << "/" << plugins.available << " opened in " << plugins.milliseconds << " ms";
+    if (plugins.probed > 0) {
+        line << " (" << plugins.probed << " not in the manifest, probed)";
+    }
+    line << "\n";
+    this->_log.info << line.str();
+}
+
+IComponent *TickDriver::clone(IObject *owner) const {
+    return new TickDriver(owner, nullptr);
+}
+
+void TickDriver::deserialize(const json::IJsonObject *data) {}
+
+void TickDriver::end() {
+    listeners.clear();
+    report();
+    Telemetry::getInstance().endSession();
+#ifdef FLAPPY_ALLOCATION_AUDIT
+    std::ostringstream audit;
+    AllocationAudit::report(audit);
+    this->_log.info << audit.str();
+#endif // FLAPPY_ALLOCATION_AUDIT
+}
+
+json::IJsonObject *TickDriver::serializeData() const {
+    return nullptr;
+}
@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** TickDriver.hpp
+*/
+
+#ifndef TICKDRIVER_HPP
+#define TICKDRIVER_HPP
+
+#include "StellarForge/Common/components/CPPMonoBehaviour.hpp"
+#include "StellarForge/Common/json/JsonObject.hpp"
+#include "StellarForge/Common/utils/Logger.hpp"
+#include "src/events/ListenerScope.hpp"
+
+/**
+ * @class TickDriver
+ * @brief Starts every presented frame on the simulation clock and reports the frame pacing.
+ *
+ * Must be the first object of the scene so the gameplay components see the
+ * steps of the current frame. The tick rate defaults to 60 Hz and can be
+ * changed with the FLAPPY_TICK_RATE environment variable. Each frame time
+ * is checked by the HitchWatchdog, whose budget FLAPPY_HITCH_BUDGET_MS
+ * overrides, and jumps and deaths go into its event history. In allocation
+ * audit builds it also counts the frames of the audit, whose warm-up can be
+ * changed with FLAPPY_AUDIT_WARMUP.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class TickDriver final : public CPPMonoBehaviour {
+public:
+    /**
+     * @brief Constructor for the TickDriver class.
+     * @param owner Pointer to the owner object.
+     * @param data JSON data for configuration.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    TickDriver(IObject *owner, const json::IJsonObject *data);
+
+    /**
+     * @brief Default destructor for the TickDriver class.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~TickDriver() override = default;
+
+    /**
+     * @brief Reads the tick rate.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void start() override;
+
+    /**
+     * @brief Accumulates the frame time into simulation steps and records it in the telemetry.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void update() override;
+
+    /**
+     * @brief Clones the tick driver component.
+     * @param owner The owner of the new component.
+     * @return A new TickDriver component clone.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    IComponent *clone(IObject *owner) const override;
+
+    /**
+     * @brief Deserializes tick driver data from JSON.
+     * @param data JSON data for deserialization.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void deserialize(const json::IJsonObject *data) override;
+
+    /**
+     * @brief Logs the pacing report and exports the session telemetry.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void end() override;
+
+    /**
+     * @brief Serializes the tick driver data into JSON format.
+     * @return Serialized JSON data.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    json::IJsonObject *serializeData() const override;
+
+private:
+    /**
+     * @brief Logs the frame pacing statistics of the last window.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void report();
+
+    /**
+     * @brief Logs the time to the first frame and the plugins opened before it.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void reportStartup();
+
+    Logger _log;
+    bool firstFrame = true; ///< The first frame was not presented yet
+    ListenerScope listeners; ///< Input and game-over listeners feeding the hitch watchdog, removed in end()
+};
+
+#endif // TICKDRIVER_HPP
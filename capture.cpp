@@ -0,0 +1,208 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Offscreen frame capture of a spectator recording with the software renderer.
+*/
+
+#include "src/assets/TextureCache.hpp"
+#include "src/render/SoftwareRenderer.hpp"
+#include "src/spectator/SpectatorDecoder.hpp"
+#include "src/spectator/SpectatorProtocol.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    struct CaptureOptions {
+        std::string input;
+        std::string assets = "assets/objects/assets";
+        std::string pngDirectory;
+        std::uint32_t pngEvery = 1;
+        std::string raw;
+        std::uint64_t maxFrames = 0;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-capture --input <recording|-> [options]\n"
+            << "  --input <path|->     spectator recording, as written by FLAPPY_SPECTATOR or --spectate\n"
+            << "  --assets <dir>       sprite textures directory (default assets/objects/assets)\n"
+            << "  --png <dir>          write frames as PNG files\n"
+            << "  --png-every <n>      only write one PNG every n frames (default 1)\n"
+            << "  --raw <path|->       write frames as raw 1920x1080 rgba video\n"
+            << "  --frames <n>         stop after n frames\n"
+            << "Example: flappy-capture --input game.fbs --raw - | ffmpeg -f rawvideo -pix_fmt rgba -s 1920x1080 -r 30 -i - game.mp4\n";
+    }
+
+    CaptureOptions parseOptions(const int argc, char *argv[])
+    {
+        CaptureOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--input") {
+                options.input = value;
+            } else if (flag == "--assets") {
+                options.assets = value;
+            } else if (flag == "--png") {
+                options.pngDirectory = value;
+            } else if (flag == "--png-every") {
+                options.pngEvery = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (flag == "--raw") {
+                options.raw = value;
+            } else if (flag == "--frames") {
+                options.maxFrames = std::stoull(value);
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.input.empty()) {
+            throw std::invalid_argument("--input is required");
+        }
+        if (options.pngEvery == 0) {
+            throw std::invalid_argument("--png-every must be positive");
+        }
+        return options;
+    }
+
+    SceneTextures loadTextures(const std::string &directory)
+    {
+        const std::string background = directory + "/background.png";
+        const std::string pipe = directory + "/pipe.png";
+        const std::string bird = directory + "/player.png";
+        auto &cache = TextureCache::getInstance();
+        cache.preload({background, pipe, bird});
+        SceneTextures textures {cache.tryGet(background), cache.tryGet(pipe), cache.tryGet(bird)};
+        if (!textures.background || !textures.pipe || !textures.bird) {
+            std::cerr << "Some textures are missing from " << directory << ", drawing flat shapes instead" << std::endl;
+        }
+        return textures;
+    }
+
+    void writePng(const Framebuffer &frame, const std::string &directory, const std::uint64_t index)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06llu.png", static_cast<unsigned long long>(index));
+        sf::Image image;
+        image.create(frame.getWidth(), frame.getHeight(), frame.data());
+        const std::string path = (std::filesystem::path(directory) / name).string();
+        if (!image.saveToFile(path)) {
+            throw std::runtime_error("Could not write " + path);
+        }
+    }
+
+    int capture(const CaptureOptions &options)
+    {
+        std::ifstream file;
+        if (options.input != "-") {
+            file.open(options.input, std::ios::binary);
+            if (!file) {
+                throw std::runtime_error("Could not open " + options.input);
+            }
+        }
+        std::istream &input = options.input == "-" ? std::cin : file;
+        std::ofstream rawFile;
+        std::ostream *raw = nullptr;
+        if (options.raw == "-") {
+            raw = &std::cout;
+        } else if (!options.raw.empty()) {
+            rawFile.open(options.raw, std::ios::binary | std::ios::trunc);
+            raw = &rawFile;
+        }
+        if (!options.pngDirectory.empty()) {
+            std::filesystem::create_directories(options.pngDirectory);
+        }
+        // Progress goes to stderr when the frames themselves go to stdout.
+        std::ostream &report = options.raw == "-" ? std::cerr : std::cout;
+
+        const auto loading = std::chrono::steady_clock::now();
+        SoftwareRenderer renderer(loadTextures(options.assets));
+        const double loadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loading).count();
+        const TextureCacheStats textureStats = TextureCache::getInstance().getStats();
+        SpectatorDecoder decoder;
+        std::vector<std::uint8_t> buffer;
+        char chunk[65536];
+        bool headerRead = false;
+        std::uint64_t frames = 0;
+        double renderSeconds = 0;
+        double writeSeconds = 0;
+
+        while (input && (options.maxFrames == 0 || frames < options.maxFrames)) {
+            input.read(chunk, sizeof(chunk));
+            const std::streamsize received = input.gcount();
+            if (received <= 0) {
+                break;
+            }
+            buffer.insert(buffer.end(), chunk, chunk + received);
+            std::size_t offset = 0;
+            if (!headerRead) {
+                offset = decoder.readHeader(buffer.data(), buffer.size());
+                headerRead = offset > 0;
+            }
+            while (headerRead && (options.maxFrames == 0 || frames < options.maxFrames)) {
+                const std::size_t consumed = decoder.readRecord(buffer.data() + offset, buffer.size() - offset);
+                if (consumed == 0) {
+                    break;
+                }
+                offset += consumed;
+                if (!decoder.isSynchronized()) {
+                    continue;
+                }
+                const auto started = std::chrono::steady_clock::now();
+                const Framebuffer &frame = renderer.render(decoder.getView());
+                const auto rendered = std::chrono::steady_clock::now();
+                if (raw != nullptr) {
+                    raw->write(reinterpret_cast<const char *>(frame.data()), static_cast<std::streamsize>(frame.size()));
+                }
+                if (!options.pngDirectory.empty() && frames % options.pngEvery == 0) {
+                    writePng(frame, options.pngDirectory, frames);
+                }
+                renderSeconds += std::chrono::duration<double>(rendered - started).count();
+                writeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - rendered).count();
+                frames++;
+            }
+            buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(offset));
+        }
+        if (!headerRead) {
+            throw std::runtime_error("Stream ended before its header");
+        }
+        if (raw != nullptr && !*raw) {
+            throw std::runtime_error("Could not write the raw frames");
+        }
+        const double seconds = static_cast<double>(frames) / decoder.getTickRate();
+        const LayerStats &layers = renderer.getLayers().getTotalStats();
+        report << frames << " frames (" << seconds << " s of play) at " << SoftwareRenderer::WIDTH << "x" << SoftwareRenderer::HEIGHT << "\n"
+            << "  render " << (frames > 0 ? renderSeconds * 1000 / frames : 0) << " ms/frame ("
+            << (renderSeconds > 0 ? frames / renderSeconds : 0) << " fps, " << (renderSeconds > 0 ? seconds / renderSeconds : 0) << "x real time)\n"
+            << "  output " << (frames > 0 ? writeSeconds * 1000 / frames : 0) << " ms/frame\n"
+            << "  background and score text layers redrawn " << layers.redrawn << " times, reused " << layers.reused << "\n"
+            << "  textures ready in " << loadMilliseconds << " ms: " << textureStats.decoded << " decoded, " << textureStats.mapped
+            << " mapped from the raw cache" << (textureStats.diskCache ? "" : " (disabled)") << ", " << textureStats.failed << " missing" << std::endl;
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return capture(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
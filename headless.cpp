@@ -0,0 +1,221 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Headless batch runner, checks that long steps give the same deaths as the 60 Hz game.
+*/
+
+#include "src/race/Autopilot.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/sim/Simulation.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::uint32_t REFERENCE_RATE = 60;
+
+    struct HeadlessOptions {
+        std::uint32_t seeds = 100;
+        std::uint32_t firstSeed = 1;
+        float step = 0.05f;
+        float duration = 120;
+        float sloppiness = 0.2f;
+        float tolerance = 0.001f;
+        bool compare = false;
+        bool verbose = false;
+    };
+
+    struct Outcome {
+        Impact impact = Impact::NONE;
+        double time = 0;
+        std::uint32_t score = 0;
+        std::uint64_t steps = 0;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-headless [options]\n"
+            << "  --seeds <n>          games to run (default 100)\n"
+            << "  --first-seed <n>     seed of the first game (default 1)\n"
+            << "  --step <ms>          simulation step (default 50)\n"
+            << "  --duration <s>       longest game time to simulate (default 120)\n"
+            << "  --sloppiness <0..1>  share of steps the autopilot ignores (default 0.2)\n"
+            << "  --compare            replay every game at 60 Hz and check the deaths match\n"
+            << "  --tolerance <ms>     allowed death time difference in compare mode (default 1)\n"
+            << "  --verbose            print every game\n"
+            << "The FLAPPY_PIPE_GAP environment variable sets the pipe gap, like in the game.\n";
+    }
+
+    HeadlessOptions parseOptions(const int argc, char *argv[])
+    {
+        HeadlessOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (flag == "--compare") {
+                options.compare = true;
+                continue;
+            }
+            if (flag == "--verbose") {
+                options.verbose = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--seeds") {
+                options.seeds = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (flag == "--first-seed") {
+                options.firstSeed = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (flag == "--step") {
+                options.step = std::stof(value) / 1000;
+            } else if (flag == "--duration") {
+                options.duration = std::stof(value);
+            } else if (flag == "--sloppiness") {
+                options.sloppiness = std::stof(value);
+            } else if (flag == "--tolerance") {
+                options.tolerance = std::stof(value) / 1000;
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.step <= 0 || options.duration <= 0) {
+            throw std::invalid_argument("--step and --duration must be positive");
+        }
+        if (!(options.sloppiness >= 0 && options.sloppiness <= 1)) {
+            throw std::invalid_argument("--sloppiness must be between 0 and 1");
+        }
+        return options;
+    }
+
+    const char *impactName(const Impact impact)
+    {
+        switch (impact) {
+        case Impact::CEILING:
+            return "ceiling";
+        case Impact::GROUND:
+            return "ground";
+        case Impact::PIPE:
+            return "pipe";
+        default:
+            return "alive";
+        }
+    }
+
+    // A death on the same instant as a point may land on either side of it depending on the step.
+    bool nearScoring(const double time, const double tolerance)
+    {
+        if (time < GameRules::SCORE_FIRST_DELAY - tolerance) {
+            return false;
+        }
+        const double phase = std::fmod(time - GameRules::SCORE_FIRST_DELAY + tolerance, GameRules::SCORE_DELAY);
+        return phase <= 2 * tolerance;
+    }
+
+    // Plays one game at the given step, either deciding the jumps or replaying them.
+    Outcome play(const std::uint32_t seed, const float step, const std::uint64_t maxSteps, Autopilot *autopilot,
+        std::vector<std::uint64_t> &jumps, const std::uint64_t stride)
+    {
+        GameSnapshot state;
+        Simulation::reset(state, seed);
+        Outcome outcome;
+        std::size_t nextJump = 0;
+        for (std::uint64_t i = 0; i < maxSteps; i++) {
+            bool jump = false;
+            if (autopilot != nullptr) {
+                jump = autopilot->decide(state);
+                if (jump) {
+                    jumps.push_back(i);
+                }
+            } else if (nextJump < jumps.size() && jumps[nextJump] * stride == i) {
+                jump = true;
+                nextJump++;
+            }
+            const Contact contact = Simulation::step(state, jump, step);
+            outcome.steps++;
+            if (contact.impact != Impact::NONE) {
+                outcome.impact = contact.impact;
+                outcome.time = static_cast<double>(i) * step + contact.time;
+                break;
+            }
+        }
+        outcome.score = state.score;
+        return outcome;
+    }
+
+    int run(const HeadlessOptions &options)
+    {
+        const double ratio = options.step * REFERENCE_RATE;
+        const auto stride = static_cast<std::uint64_t>(std::lround(ratio));
+        if (options.compare && (stride == 0 || std::abs(ratio - static_cast<double>(stride)) > 1e-4)) {
+            throw std::invalid_argument("--compare needs a step that is a whole number of 60 Hz ticks");
+        }
+        const auto maxSteps = static_cast<std::uint64_t>(std::ceil(options.duration / options.step));
+        std::uint32_t deaths = 0;
+        std::uint32_t mismatches = 0;
+        std::uint64_t steps = 0;
+        std::uint64_t totalScore = 0;
+        double worstDrift = 0;
+        std::vector<std::uint64_t> jumps;
+        const auto started = std::chrono::steady_clock::now();
+        for (std::uint32_t seed = options.firstSeed; seed < options.firstSeed + options.seeds; seed++) {
+            jumps.clear();
+            Autopilot autopilot(seed * 31, options.sloppiness);
+            const Outcome outcome = play(seed, options.step, maxSteps, &autopilot, jumps, 1);
+            steps += outcome.steps;
+            totalScore += outcome.score;
+            deaths += outcome.impact != Impact::NONE ? 1 : 0;
+            bool agrees = true;
+            Outcome reference;
+            if (options.compare) {
+                reference = play(seed, 1.0f / REFERENCE_RATE, maxSteps * stride, nullptr, jumps, stride);
+                const double drift = std::abs(reference.time - outcome.time);
+                const std::uint32_t scoreGap = reference.score > outcome.score ? reference.score - outcome.score : outcome.score - reference.score;
+                agrees = reference.impact == outcome.impact && (outcome.impact == Impact::NONE || drift <= options.tolerance)
+                    && (scoreGap == 0 || (scoreGap == 1 && nearScoring(outcome.time, options.tolerance)));
+                if (reference.impact == outcome.impact && outcome.impact != Impact::NONE && drift > worstDrift) {
+                    worstDrift = drift;
+                }
+                mismatches += agrees ? 0 : 1;
+            }
+            if (options.verbose || !agrees) {
+                std::cout << "seed " << seed << ": " << impactName(outcome.impact) << " at " << outcome.time << " s, score " << outcome.score;
+                if (options.compare) {
+                    std::cout << (agrees ? " | 60 Hz agrees" : " | 60 Hz: ");
+                    if (!agrees) {
+                        std::cout << impactName(reference.impact) << " at " << reference.time << " s, score " << reference.score;
+                    }
+                }
+                std::cout << "\n";
+            }
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        std::cout << options.seeds << " games at " << options.step * 1000 << " ms steps, " << deaths << " deaths, mean score "
+            << (options.seeds > 0 ? static_cast<double>(totalScore) / options.seeds : 0) << "\n"
+            << "  " << steps << " steps in " << seconds * 1000 << " ms (" << (seconds > 0 ? steps / seconds : 0) << " steps/s)\n";
+        if (options.compare) {
+            std::cout << "  60 Hz replay: " << options.seeds - mismatches << " agree, " << mismatches << " differ, worst death time drift "
+                << worstDrift * 1000 << " ms" << std::endl;
+        }
+        return mismatches == 0 ? 0 : 2;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return run(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
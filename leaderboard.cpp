@@ -0,0 +1,208 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Prints the local leaderboard, or measures it with synthetic results.
+*/
+
+#include "src/leaderboard/Leaderboard.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::size_t QUERY_ROUNDS = 100000;
+
+    // Written after the timed queries so the compiler cannot drop them.
+    volatile std::uint64_t querySink = 0;
+
+    struct ToolOptions {
+        std::string directory;
+        std::size_t top = 10;
+        std::vector<double> percentiles;
+        std::uint64_t bench = 0;
+        std::uint64_t compact = Leaderboard::DEFAULT_COMPACT_RECORDS;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-leaderboard [options]\n"
+            << "  --dir <path>         leaderboard directory (default " << Leaderboard::DEFAULT_DIRECTORY
+            << ", a temporary one with --bench)\n"
+            << "  --top <n>            best results to print (default 10)\n"
+            << "  --percentile <p>     print the score at percentile p, from 0 to 100, repeatable (default 50, 90 and 99)\n"
+            << "  --bench <n>          submit n synthetic results and time the submits, the compactions and the queries\n"
+            << "  --compact <n>        log length that triggers a compaction (default " << Leaderboard::DEFAULT_COMPACT_RECORDS << ")\n";
+    }
+
+    ToolOptions parseOptions(const int argc, char *argv[])
+    {
+        ToolOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--dir") {
+                options.directory = value;
+            } else if (flag == "--top") {
+                options.top = std::stoul(value);
+            } else if (flag == "--percentile") {
+                options.percentiles.push_back(std::stod(value));
+            } else if (flag == "--bench") {
+                options.bench = std::stoull(value);
+            } else if (flag == "--compact") {
+                options.compact = std::stoull(value);
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.percentiles.empty()) {
+            options.percentiles = {50, 90, 99};
+        }
+        for (const double percentile : options.percentiles) {
+            if (percentile < 0 || percentile > 100) {
+                throw std::invalid_argument("--percentile must be between 0 and 100");
+            }
+        }
+        if (options.compact == 0) {
+            throw std::invalid_argument("--compact must be positive");
+        }
+        return options;
+    }
+
+    std::string formatTimestamp(const std::int64_t milliseconds)
+    {
+        const std::time_t seconds = static_cast<std::time_t>(milliseconds / 1000);
+        std::tm utc {};
+#ifdef _WIN32
+        gmtime_s(&utc, &seconds);
+#else
+        gmtime_r(&seconds, &utc);
+#endif // _WIN32
+        std::ostringstream text;
+        text << std::put_time(&utc, "%Y-%m-%d %H:%M:%S UTC");
+        return text.str();
+    }
+
+    void printStandings(const Leaderboard &leaderboard, const ToolOptions &options)
+    {
+        const LeaderboardStats stats = leaderboard.getStats();
+        std::cout << stats.results << " results, " << stats.logged << " in the log, " << stats.compactions << " compactions"
+            << (stats.persistent ? "" : ", not persistent") << "\n";
+        const std::vector<ScoreRecord> best = leaderboard.top(options.top);
+        for (std::size_t i = 0; i < best.size(); i++) {
+            std::cout << std::setw(4) << i + 1 << "  score " << std::setw(5) << best[i].score
+                << "  seed 0x" << std::hex << std::setw(8) << std::setfill('0') << best[i].seed << std::dec << std::setfill(' ')
+                << "  " << std::fixed << std::setprecision(1) << std::setw(7) << best[i].durationMs / 1000.0 << " s  "
+                << formatTimestamp(best[i].timestamp) << "\n";
+        }
+        for (const double percentile : options.percentiles) {
+            std::cout << "percentile " << std::defaultfloat << std::setprecision(6) << percentile << ": score " << leaderboard.scoreAt(percentile / 100) << "\n";
+        }
+    }
+
+    // Finished games end quickly far more often than late, roughly like a geometric law.
+    std::vector<ScoreRecord> syntheticResults(const std::uint64_t count)
+    {
+        std::mt19937 random(42);
+        std::geometric_distribution<std::uint32_t> score(0.08);
+        std::vector<ScoreRecord> results(count);
+        const std::int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        for (std::uint64_t i = 0; i < count; i++) {
+            results[i].score = score(random);
+            results[i].seed = static_cast<std::uint32_t>(random());
+            results[i].durationMs = 8500 + results[i].score * 2000;
+            results[i].timestamp = now - static_cast<std::int64_t>(count - i);
+        }
+        return results;
+    }
+
+    template <typename Query>
+    double timeQuery(Query &&query)
+    {
+        std::uint64_t sink = 0;
+        const auto started = Clock::now();
+        for (std::size_t i = 0; i < QUERY_ROUNDS; i++) {
+            sink += query(i);
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - started).count();
+        querySink = sink;
+        return seconds * 1e9 / QUERY_ROUNDS;
+    }
+
+    int bench(const ToolOptions &options)
+    {
+        const bool temporary = options.directory.empty();
+        const std::string directory = temporary ? (std::filesystem::temp_directory_path() / "flappy-leaderboard-bench").string() : options.directory;
+        if (temporary) {
+            std::filesystem::remove_all(directory);
+        }
+        const std::vector<ScoreRecord> results = syntheticResults(options.bench);
+        {
+            Leaderboard leaderboard(directory, options.compact);
+            leaderboard.flush();
+            const auto started = Clock::now();
+            for (const auto &result : results) {
+                leaderboard.submit(result);
+            }
+            const double submitSeconds = std::chrono::duration<double>(Clock::now() - started).count();
+            leaderboard.flush();
+            const double applySeconds = std::chrono::duration<double>(Clock::now() - started).count();
+            const double count = static_cast<double>(results.size() > 0 ? results.size() : 1);
+            std::cout << results.size() << " results submitted\n"
+                << "  submit: " << submitSeconds * 1e9 / count << " ns/result on the calling thread\n"
+                << "  logged and ranked: " << applySeconds << " s, " << count / applySeconds / 1e6 << " M results/s\n";
+            std::cout << "  top 10: " << timeQuery([&leaderboard](std::size_t) { return leaderboard.top(10).size(); }) << " ns/query\n"
+                << "  rank of a score: " << timeQuery([&leaderboard](std::size_t i) { return static_cast<std::uint64_t>(leaderboard.rankOf(static_cast<std::uint32_t>(i % 64)) * 100); }) << " ns/query\n"
+                << "  score at a percentile: " << timeQuery([&leaderboard](std::size_t i) { return leaderboard.scoreAt(static_cast<double>(i % 100) / 100); }) << " ns/query\n";
+        }
+        const auto reopened = Clock::now();
+        Leaderboard leaderboard(directory, options.compact);
+        leaderboard.flush();
+        std::cout << "  reopened in " << std::chrono::duration<double>(Clock::now() - reopened).count() * 1000 << " ms\n";
+        printStandings(leaderboard, options);
+        if (temporary) {
+            std::error_code error;
+            std::filesystem::remove_all(directory, error);
+        }
+        return 0;
+    }
+
+    int run(const ToolOptions &options)
+    {
+        if (options.bench > 0) {
+            return bench(options);
+        }
+        Leaderboard leaderboard(options.directory.empty() ? Leaderboard::DEFAULT_DIRECTORY : options.directory, options.compact);
+        leaderboard.flush();
+        printStandings(leaderboard, options);
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return run(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,180 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Compares one Lua interpreter per scripted object with the shared interpreter.
+*/
+
+#include "src/script/LuaVM.hpp"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct BenchOptions {
+        std::vector<std::string> scripts;
+        std::size_t objects = 1000;
+        std::size_t frames = 60;
+    };
+
+    struct BenchResult {
+        std::size_t bytes = 0;
+        double instantiateSeconds = 0;
+        double runSeconds = 0;
+        bool failed = false;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-lua-bench [options]\n"
+            << "  --script <path>    script given to the objects, repeat to alternate several\n"
+            << "                     (default Bird.lua and Score.lua)\n"
+            << "  --objects <n>      scripted objects to create (default 1000)\n"
+            << "  --frames <n>       times every object runs its script after start (default 60)\n";
+    }
+
+    BenchOptions parseOptions(const int argc, char *argv[])
+    {
+        BenchOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--script") {
+                options.scripts.push_back(value);
+            } else if (flag == "--objects") {
+                options.objects = std::stoul(value);
+            } else if (flag == "--frames") {
+                options.frames = std::stoul(value);
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.scripts.empty()) {
+            options.scripts = {"assets/objects/scripts/Bird.lua", "assets/objects/scripts/Score.lua"};
+        }
+        if (options.objects == 0) {
+            throw std::invalid_argument("--objects must be positive");
+        }
+        return options;
+    }
+
+    // Gives an object the binding tables both scripts use, as LuaScript does for a Bird or Score object.
+    int instantiate(LuaVM &vm, const std::string &script, int &chunk)
+    {
+        chunk = vm.compile(script);
+        const int environment = vm.createEnvironment();
+        vm.addTable(environment, "transform");
+        vm.addTable(environment, "rigidbody");
+        vm.addTable(environment, "text");
+        vm.setNumber(environment, "text", "colorR", 255);
+        vm.setNumber(environment, "text", "colorG", 255);
+        vm.setNumber(environment, "text", "colorB", 255);
+        vm.setFlag(environment, "start", true);
+        return environment;
+    }
+
+    bool runFrames(LuaVM &vm, const int chunk, const int environment, const std::size_t frames)
+    {
+        bool passed = vm.run(chunk, environment);
+        vm.setFlag(environment, "start", false);
+        for (std::size_t i = 0; i < frames && passed; i++) {
+            passed = vm.run(chunk, environment);
+        }
+        return passed;
+    }
+
+    // One interpreter per object, as the engine LuaScriptComponent does.
+    BenchResult benchSeparate(const BenchOptions &options)
+    {
+        BenchResult result;
+        std::vector<std::unique_ptr<LuaVM>> machines;
+        std::vector<int> chunks(options.objects);
+        std::vector<int> environments(options.objects);
+        machines.reserve(options.objects);
+        const auto started = Clock::now();
+        for (std::size_t i = 0; i < options.objects; i++) {
+            machines.push_back(std::make_unique<LuaVM>());
+            environments[i] = instantiate(*machines[i], options.scripts[i % options.scripts.size()], chunks[i]);
+        }
+        const auto instantiated = Clock::now();
+        for (std::size_t i = 0; i < options.objects; i++) {
+            result.failed = !runFrames(*machines[i], chunks[i], environments[i], options.frames) || result.failed;
+        }
+        result.runSeconds = std::chrono::duration<double>(Clock::now() - instantiated).count();
+        result.instantiateSeconds = std::chrono::duration<double>(instantiated - started).count();
+        for (const auto &machine : machines) {
+            result.bytes += machine->getMemoryUsage();
+        }
+        return result;
+    }
+
+    // Every object in one interpreter, as LuaScript does.
+    BenchResult benchShared(const BenchOptions &options, std::size_t &fixedBytes)
+    {
+        BenchResult result;
+        LuaVM vm;
+        for (const auto &script : options.scripts) {
+            vm.compile(script);
+        }
+        fixedBytes = vm.getMemoryUsage();
+        std::vector<int> chunks(options.objects);
+        std::vector<int> environments(options.objects);
+        const auto started = Clock::now();
+        for (std::size_t i = 0; i < options.objects; i++) {
+            environments[i] = instantiate(vm, options.scripts[i % options.scripts.size()], chunks[i]);
+        }
+        const auto instantiated = Clock::now();
+        for (std::size_t i = 0; i < options.objects; i++) {
+            result.failed = !runFrames(vm, chunks[i], environments[i], options.frames) || result.failed;
+        }
+        result.runSeconds = std::chrono::duration<double>(Clock::now() - instantiated).count();
+        result.instantiateSeconds = std::chrono::duration<double>(instantiated - started).count();
+        result.bytes = vm.getMemoryUsage() - fixedBytes;
+        return result;
+    }
+
+    void report(const char *name, const BenchResult &result, const BenchOptions &options)
+    {
+        const auto objects = static_cast<double>(options.objects);
+        std::cout << name << ": " << static_cast<double>(result.bytes) / objects << " bytes/object, "
+            << result.instantiateSeconds * 1e6 / objects << " us/instantiation, "
+            << result.runSeconds * 1e9 / (objects * static_cast<double>(options.frames + 1)) << " ns/run\n";
+    }
+
+    int run(const BenchOptions &options)
+    {
+        std::size_t fixedBytes = 0;
+        const BenchResult separate = benchSeparate(options);
+        const BenchResult shared = benchShared(options, fixedBytes);
+        std::cout << options.objects << " objects over " << options.scripts.size() << " scripts, " << options.frames + 1 << " runs each\n";
+        report("  one interpreter per object", separate, options);
+        report("  shared interpreter        ", shared, options);
+        std::cout << "  shared interpreter and compiled scripts: " << fixedBytes << " bytes once\n"
+            << "  memory per object divided by " << static_cast<double>(separate.bytes) / static_cast<double>(shared.bytes > 0 ? shared.bytes : 1)
+            << ", instantiation " << separate.instantiateSeconds / (shared.instantiateSeconds > 0 ? shared.instantiateSeconds : 1e-9) << "x faster" << std::endl;
+        return separate.failed || shared.failed ? 2 : 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return run(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -8,27 +8,57 @@
 
 #include "assets/objects/scripts/Background.hpp"
 #include "assets/objects/scripts/Bird.hpp"
+#include "assets/objects/scripts/LuaScript.hpp"
 #include "assets/objects/scripts/Pipes.hpp"
 #include "assets/objects/scripts/Score.hpp"
+#include "assets/objects/scripts/StateRecorder.hpp"
+#include "assets/objects/scripts/SpectatorFeed.hpp"
+#include "assets/objects/scripts/TickDriver.hpp"
 #include "StellarForge/Engine/Engine.hpp"
 #include "StellarForge/Common/factories/ComponentFactory.hpp"
-#include "StellarForge/Common/components/DynamicComponentLoader.hpp"
+#include "src/assets/PipePairTexture.hpp"
+#include "src/assets/SceneAssets.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include "src/leaderboard/Leaderboard.hpp"
+#include "src/plugins/PluginLoader.hpp"
+#include "src/sim/Simulation.hpp"
 #include <iostream>
+#include <stdexcept>
 
 int main(int argc, char* argv[])
 {
     try {
-        auto loader = DynamicComponentLoader("assets/components");
-        Engine const engine([&loader]() {
+        const std::string scene = "assets/scenes/json/Scene.json";
+        const std::string objects = "assets/objects/json";
+        // The pipe pair sprite is built from the single pipe for the gap Pipes spawns, before the engine loads the scene.
+        try {
+            PipePairTexture::update("assets/objects/assets/pipe.png", PipePairTexture::PAIR_PATH, Simulation::configuredPipeGap());
+        } catch (const std::runtime_error &e) {
+            std::cerr << e.what() << ", the pipes are drawn without their texture" << std::endl;
+        }
+        // The leaderboard replays its log on its own thread, started now so it is ready by the first game over.
+        Leaderboard::getInstance();
+        const std::vector<std::string> components = SceneAssets::componentNames(scene, objects);
+        Engine const engine([&components]() {
             REGISTER_COMPONENT(Background);
             REGISTER_COMPONENT(Bird);
+            REGISTER_COMPONENT(LuaScript);
             REGISTER_COMPONENT(Pipes);
             REGISTER_COMPONENT(Score);
-            loader.loadComponents();
+            REGISTER_COMPONENT(StateRecorder);
+            REGISTER_COMPONENT(SpectatorFeed);
+            REGISTER_COMPONENT(TickDriver);
+            // Only the plugins registering a component of the scene are opened.
+            PluginLoader::getInstance().load(components, &ComponentFactory::getInstance());
         }, "FlappyBird");
     } catch (const std::exception &e) {
         std::cerr << e.what() << std::endl;
         return 1;
     }
+#ifdef FLAPPY_ALLOCATION_AUDIT
+    if (!AllocationAudit::passed()) {
+        return 3;
+    }
+#endif // FLAPPY_ALLOCATION_AUDIT
     return 0;
 }
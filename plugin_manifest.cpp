@@ -0,0 +1,57 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Writes the component manifest of a plugin directory, run after each plugin build.
+*/
+
+#include "src/plugins/ComponentManifest.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-plugin-manifest [directory]\n"
+            << "  Lists the components of every plugin library of the directory (default assets/components)\n"
+            << "  into " << ComponentManifest::FILE_NAME << ", so the game opens only the libraries a scene uses.\n";
+    }
+
+    int writeManifest(const std::string &directory)
+    {
+        ComponentManifest manifest;
+        int failures = 0;
+        for (const auto &library : ComponentManifest::libraries(directory)) {
+            try {
+                const ManifestEntry entry = ComponentManifest::probe(directory, library);
+                std::cout << library << ":";
+                for (const auto &component : entry.components) {
+                    std::cout << " " << component;
+                }
+                std::cout << "\n";
+                manifest.set(entry);
+            } catch (const std::exception &e) {
+                std::cerr << e.what() << std::endl;
+                failures++;
+            }
+        }
+        manifest.write(directory);
+        std::cout << manifest.getEntries().size() << " libraries listed in " << directory << "/" << ComponentManifest::FILE_NAME << std::endl;
+        return failures == 0 ? 0 : 2;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        if (argc > 2 || (argc == 2 && std::string(argv[1]) == "--help")) {
+            printUsage();
+            return argc > 2 ? 1 : 0;
+        }
+        return writeManifest(argc == 2 ? argv[1] : "assets/components");
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
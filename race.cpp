@@ -0,0 +1,205 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Headless two-player race over UDP with rollback.
+*/
+
+#include "src/net/LinkConditioner.hpp"
+#include "src/net/UdpSocket.hpp"
+#include "src/race/Autopilot.hpp"
+#include "src/race/RollbackSession.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/sim/Simulation.hpp"
+#include "src/spectator/SpectatorEncoder.hpp"
+#include "src/spectator/SpectatorSink.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+    struct RaceOptions {
+        int player = 0;
+        std::uint16_t port = 7000;
+        std::string peerHost = "127.0.0.1";
+        std::uint16_t peerPort = 7001;
+        std::uint32_t seed = 42;
+        std::uint32_t frames = 1800;
+        std::uint32_t tickRate = 60;
+        float loss = 0;
+        int latency = 0;
+        int jitter = 0;
+        float sloppiness = 0.2f;
+        std::string spectate;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-race --player <0|1> --port <port> --peer-port <port> [options]\n"
+            << "  --peer-host <ipv4>   address of the other player (default 127.0.0.1)\n"
+            << "  --seed <n>           pipe course seed, must match the peer (default 42)\n"
+            << "  --frames <n>         frames to race (default 1800)\n"
+            << "  --tick-rate <hz>     simulation rate (default 60)\n"
+            << "  --loss <0..1>        outgoing packet loss to inject\n"
+            << "  --latency <ms>       outgoing latency to inject\n"
+            << "  --jitter <ms>        extra random outgoing latency to inject\n"
+            << "  --sloppiness <0..1>  share of ticks the autopilot ignores (default 0.2)\n"
+            << "  --spectate <target>  stream the local game to a file or unix:<socket path>\n"
+            << "The FLAPPY_PIPE_GAP environment variable sets the pipe gap, like in the game; it must match the peer.\n";
+    }
+
+    RaceOptions parseOptions(const int argc, char *argv[])
+    {
+        RaceOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--player") {
+                options.player = std::stoi(value);
+            } else if (flag == "--port") {
+                options.port = static_cast<std::uint16_t>(std::stoul(value));
+            } else if (flag == "--peer-host") {
+                options.peerHost = value;
+            } else if (flag == "--peer-port") {
+                options.peerPort = static_cast<std::uint16_t>(std::stoul(value));
+            } else if (flag == "--seed") {
+                options.seed = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (flag == "--frames") {
+                options.frames = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (flag == "--tick-rate") {
+                options.tickRate = static_cast<std::uint32_t>(std::stoul(value));
+            } else if (flag == "--loss") {
+                options.loss = std::stof(value);
+            } else if (flag == "--latency") {
+                options.latency = std::stoi(value);
+            } else if (flag == "--jitter") {
+                options.jitter = std::stoi(value);
+            } else if (flag == "--sloppiness") {
+                options.sloppiness = std::stof(value);
+            } else if (flag == "--spectate") {
+                options.spectate = value;
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        if (options.player != 0 && options.player != 1) {
+            throw std::invalid_argument("--player must be 0 or 1");
+        }
+        if (options.tickRate == 0) {
+            throw std::invalid_argument("--tick-rate must be positive");
+        }
+        if (!(options.sloppiness >= 0 && options.sloppiness <= 1)) {
+            throw std::invalid_argument("--sloppiness must be between 0 and 1");
+        }
+        return options;
+    }
+
+    void exchange(RollbackSession &session, const UdpSocket &socket, LinkConditioner &link)
+    {
+        std::uint8_t buffer[RollbackSession::MAX_PACKET_SIZE];
+        for (std::size_t size = socket.receive(buffer, sizeof(buffer)); size > 0; size = socket.receive(buffer, sizeof(buffer))) {
+            session.readPacket(buffer, size);
+        }
+        link.send(buffer, session.writePacket(buffer));
+        link.flush();
+    }
+
+    void printReport(const RaceOptions &options, const RollbackSession &session, const LinkConditioner &link)
+    {
+        const RollbackStats &stats = session.getStats();
+        const RaceState &state = session.getState();
+        const double seconds = static_cast<double>(stats.frames) / options.tickRate;
+        std::cout << "player " << options.player << " frames " << stats.frames << "\n"
+            << "  rollbacks " << stats.rollbacks << " (" << (seconds > 0 ? stats.rollbacks / seconds : 0) << "/s, "
+            << (stats.frames > 0 ? 100.0 * stats.rollbacks / stats.frames : 0) << "% of frames)\n"
+            << "  resimulated frames " << stats.resimulatedFrames << ", max depth " << stats.maxRollbackDepth << "\n"
+            << "  resimulation cost avg " << (stats.rollbacks > 0 ? stats.resimulationNanoseconds / stats.rollbacks / 1000.0 : 0)
+            << " us, max " << stats.maxResimulationNanoseconds / 1000.0 << " us\n"
+            << "  prediction stalls " << stats.predictionStalls << "\n"
+            << "  packets sent " << link.getSentCount() << ", dropped " << link.getDroppedCount()
+            << ", received " << stats.packetsReceived << "\n"
+            << "  checksums compared " << stats.checksumsCompared << ", desyncs " << stats.desyncs << "\n"
+            << "  score " << state.players[0].score << (state.players[0].birdDead ? " (dead)" : "")
+            << " vs " << state.players[1].score << (state.players[1].birdDead ? " (dead)" : "") << "\n"
+            << "  final checksum " << std::hex << (Simulation::checksum(state.players[0]) ^ Simulation::checksum(state.players[1]))
+            << std::dec << std::endl;
+    }
+
+    int race(const RaceOptions &options)
+    {
+        const UdpSocket socket(options.port, options.peerHost, options.peerPort);
+        LinkConditioner link(socket, options.loss, std::chrono::milliseconds(options.latency),
+            std::chrono::milliseconds(options.jitter), options.seed * 2 + options.player);
+        RollbackSession session(options.player, options.seed, 1.0f / static_cast<float>(options.tickRate));
+        Autopilot autopilot(options.seed * 31 + options.player, options.sloppiness);
+        std::unique_ptr<SpectatorSink> spectator;
+        SpectatorEncoder encoder(options.tickRate, options.tickRate * 2, GameRules::PIPE_SPEED);
+        std::vector<std::uint8_t> stream;
+        if (!options.spectate.empty()) {
+            spectator = std::make_unique<SpectatorSink>(options.spectate);
+            encoder.writeHeader(stream);
+        }
+        const auto tick = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / options.tickRate));
+
+        const auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!session.isConnected()) {
+            if (std::chrono::steady_clock::now() > giveUp) {
+                throw std::runtime_error("No answer from the peer");
+            }
+            exchange(session, socket, link);
+            std::this_thread::sleep_for(tick);
+        }
+
+        auto next = std::chrono::steady_clock::now();
+        while (session.getFrame() < options.frames || session.getConfirmedFrames() < options.frames) {
+            session.synchronize();
+            if (session.getFrame() < options.frames) {
+                if (session.canAdvance()) {
+                    session.advance(autopilot.decide(session.getState().players[options.player]));
+                    if (spectator) {
+                        encoder.encode(session.getState().players[options.player], stream);
+                        spectator->write(stream.data(), stream.size());
+                        stream.clear();
+                    }
+                } else {
+                    session.stall();
+                }
+            }
+            exchange(session, socket, link);
+            next += tick;
+            std::this_thread::sleep_until(next);
+        }
+        session.synchronize();
+
+        // Keep answering for a while so the peer receives our last inputs.
+        const auto linger = std::chrono::steady_clock::now() + std::chrono::seconds(1) + std::chrono::milliseconds(options.latency + options.jitter);
+        while (std::chrono::steady_clock::now() < linger) {
+            exchange(session, socket, link);
+            std::this_thread::sleep_for(tick);
+        }
+        printReport(options, session, link);
+        return session.getStats().desyncs == 0 ? 0 : 2;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return race(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,191 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Restarts the game state many times and checks that no event listener leaks.
+*/
+
+#include "src/events/ListenerScope.hpp"
+#include "src/state/GameState.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct CheckOptions {
+        std::size_t restarts = 10000;
+    };
+
+    // Registers its listeners in start and removes them in end, like the game components.
+    struct FakeComponent final : ISnapshotable {
+        ListenerScope listeners;
+        std::size_t deaths = 0;
+        bool dead = false;
+
+        void start()
+        {
+            listeners.listen("bird_died", [this](const EventData &data) {
+                deaths++;
+                dead = true;
+            });
+            listeners.listen("space_pressed", [](const EventData &data) {});
+            GameState::getInstance().registerParticipant(this);
+        }
+
+        void end()
+        {
+            listeners.clear();
+            GameState::getInstance().unregisterParticipant(this);
+        }
+
+        void saveState(GameSnapshot &snapshot) override { snapshot.birdDead = dead; }
+        void loadState(const GameSnapshot &snapshot) override { dead = snapshot.birdDead; }
+        void resetState() override { dead = false; }
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-restart-check [options]\n"
+            << "  --restarts <n>    games restarted in place (default 10000)\n";
+    }
+
+    CheckOptions parseOptions(const int argc, char *argv[])
+    {
+        CheckOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string flag = argv[i];
+            if (flag == "--help") {
+                printUsage();
+                std::exit(0);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--restarts") {
+                options.restarts = std::stoul(value);
+            } else {
+                throw std::invalid_argument("Unknown option " + flag);
+            }
+        }
+        return options;
+    }
+
+    bool expect(const bool condition, const char *what)
+    {
+        std::cout << (condition ? "  ok      " : "  FAILED  ") << what << "\n";
+        return condition;
+    }
+
+    void trigger(const char *event)
+    {
+        EventSystem::getInstance().triggerEvents(event, nullptr);
+    }
+
+    // Dies and restarts the way StateRecorder does, and re-creates one component every other game.
+    bool checkRestarts(const std::size_t restarts)
+    {
+        auto &events = GameEvents::getInstance();
+        const std::size_t baseline = events.getListenerCount();
+        FakeComponent kept;
+        FakeComponent recreated;
+        kept.start();
+        recreated.start();
+        const std::size_t listeners = events.getListenerCount();
+        const std::size_t forwarders = events.getForwarderCount();
+        double worst = 0;
+        bool revived = true;
+        for (std::size_t i = 0; i < restarts; i++) {
+            trigger("bird_died");
+            const auto started = Clock::now();
+            GameState::getInstance().reset();
+            worst = std::max(worst, std::chrono::duration<double, std::milli>(Clock::now() - started).count());
+            revived = revived && !kept.dead && !recreated.dead;
+            if (i % 2 == 1) {
+                recreated.end();
+                recreated.start();
+            }
+        }
+        std::cout << restarts << " restarts, slowest reset " << worst << " ms, " << events.getListenerCount() << " listeners, "
+            << events.getForwarderCount() << " forwarders\n";
+        bool passed = expect(revived, "every restart revives the bird");
+        passed = expect(kept.deaths == restarts && recreated.deaths == restarts, "each death reaches each listener once") && passed;
+        passed = expect(events.getListenerCount() == listeners, "no listener leaks across restarts") && passed;
+        passed = expect(events.getForwarderCount() == forwarders, "one engine forwarder per event name") && passed;
+        kept.end();
+        recreated.end();
+        return expect(events.getListenerCount() == baseline, "end removes every listener") && passed;
+    }
+
+    bool checkRemoval()
+    {
+        auto &events = GameEvents::getInstance();
+        int calls = 0;
+        const GameEvents::ListenerId first = events.addListener("restart_check", [&calls](const EventData &data) { calls += 1; });
+        const GameEvents::ListenerId second = events.addListener("restart_check", [&calls](const EventData &data) { calls += 10; });
+        events.removeListener(first);
+        events.removeListener(first);
+        events.removeListener(0);
+        trigger("restart_check");
+        events.removeListener(second);
+        trigger("restart_check");
+        return expect(calls == 10, "a listener removed by id is not called, unknown ids are ignored");
+    }
+
+    bool checkReentrantDispatch()
+    {
+        auto &events = GameEvents::getInstance();
+        const std::size_t before = events.getListenerCount();
+        int selfRemoved = 0;
+        int removedByEarlier = 0;
+        int addedDuring = 0;
+        int nested = 0;
+        GameEvents::ListenerId self = 0;
+        GameEvents::ListenerId later = 0;
+        GameEvents::ListenerId added = 0;
+        self = events.addListener("restart_reentry", [&](const EventData &data) {
+            selfRemoved++;
+            events.removeListener(self);
+            events.removeListener(later);
+            if (added == 0) {
+                added = events.addListener("restart_reentry", [&addedDuring](const EventData &data) { addedDuring++; });
+            }
+            trigger("restart_reentry");
+        });
+        const GameEvents::ListenerId counter = events.addListener("restart_reentry", [&nested](const EventData &data) { nested++; });
+        later = events.addListener("restart_reentry", [&removedByEarlier](const EventData &data) { removedByEarlier++; });
+        trigger("restart_reentry");
+        bool passed = expect(selfRemoved == 1 && nested == 1, "a nested trigger of the event being dispatched is ignored");
+        passed = expect(removedByEarlier == 0, "a listener removed earlier in the same dispatch is skipped") && passed;
+        passed = expect(addedDuring == 0, "a listener added during a dispatch waits for the next one") && passed;
+        trigger("restart_reentry");
+        passed = expect(selfRemoved == 1 && addedDuring == 1 && nested == 2, "removed listeners stay removed, added ones join") && passed;
+        events.removeListener(counter);
+        events.removeListener(added);
+        return expect(events.getListenerCount() == before, "the dispatch leaves no listener behind") && passed;
+    }
+
+    int run(const CheckOptions &options)
+    {
+        bool passed = checkRestarts(options.restarts);
+        passed = checkRemoval() && passed;
+        passed = checkReentrantDispatch() && passed;
+        std::cout << "Restart check " << (passed ? "passed" : "FAILED") << "\n";
+        return passed ? 0 : 2;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return run(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
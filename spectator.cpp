@@ -0,0 +1,327 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Lightweight viewer of spectator streams.
+*/
+
+#include "src/render/LayerCache.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/spectator/SpectatorDecoder.hpp"
+#include "src/spectator/SpectatorProtocol.hpp"
+#include "src/utils/Hash.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+    constexpr int GRID_WIDTH = 64;
+    constexpr int GRID_HEIGHT = 20;
+
+    struct ViewerOptions {
+        std::string source;
+        bool listen = false;
+        bool draw = false;
+        bool realtime = false;
+    };
+
+    void printUsage()
+    {
+        std::cout << "Usage: flappy-spectator [options] <stream file>\n"
+            << "       flappy-spectator [options] --listen <unix socket path>\n"
+            << "  --draw      draw the play field in the terminal\n"
+            << "  --realtime  replay a file at its recorded tick rate\n";
+    }
+
+    ViewerOptions parseOptions(const int argc, char *argv[])
+    {
+        ViewerOptions options;
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            if (arg == "--help") {
+                printUsage();
+                std::exit(0);
+            } else if (arg == "--draw") {
+                options.draw = true;
+            } else if (arg == "--realtime") {
+                options.realtime = true;
+            } else if (arg == "--listen" && i + 1 < argc) {
+                options.listen = true;
+                options.source = argv[++i];
+            } else if (options.source.empty() && arg.rfind("--", 0) != 0) {
+                options.source = arg;
+            } else {
+                throw std::invalid_argument("Unknown option " + arg);
+            }
+        }
+        if (options.source.empty()) {
+            printUsage();
+            throw std::invalid_argument("No stream to watch");
+        }
+        return options;
+    }
+
+    int openSource(const ViewerOptions &options)
+    {
+        if (!options.listen) {
+            const int fd = open(options.source.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("Cannot open " + options.source);
+            }
+            return fd;
+        }
+        sockaddr_un address {};
+        if (options.source.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Socket path too long: " + options.source);
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, options.source.c_str(), options.source.size() + 1);
+        unlink(options.source.c_str());
+        const int server = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (server < 0 || bind(server, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || ::listen(server, 1) < 0) {
+            close(server);
+            throw std::runtime_error("Cannot listen on " + options.source);
+        }
+        std::cout << "Waiting for a session on " << options.source << std::endl;
+        const int client = accept(server, nullptr, nullptr);
+        close(server);
+        unlink(options.source.c_str());
+        if (client < 0) {
+            throw std::runtime_error("Cannot accept a session on " + options.source);
+        }
+        return client;
+    }
+
+    /**
+     * @class TerminalView
+     * @brief Draws the play field in the terminal from cached layers.
+     *
+     * The border, the pipes, the bird and the score are separate layers. A
+     * layer is only redrawn when its inputs change, and only the terminal rows
+     * that differ from what is already on screen are written.
+     */
+    class TerminalView {
+    public:
+        void draw(const GameSnapshot &view)
+        {
+            _layers.beginFrame();
+            _out.clear();
+            if (_layers.update(FRAME, 0)) {
+                drawFrame();
+            }
+            const bool pipesChanged = _layers.update(PIPES, pipesFingerprint(view));
+            if (pipesChanged) {
+                drawPipes(view);
+            }
+            const bool birdChanged = _layers.update(BIRD, birdFingerprint(view));
+            if (birdChanged) {
+                drawBird(view);
+            }
+            if (pipesChanged || birdChanged) {
+                composeField();
+            }
+            if (_layers.update(HUD, Hash::combine(Hash::combine(Hash::FNV_OFFSET, view.score), view.gameOver))) {
+                _out += "\033[1;1H\033[Kscore " + std::to_string(view.score) + (view.gameOver ? "  GAME OVER" : "");
+            }
+            const LayerStats &frame = _layers.getFrameStats();
+            _out += "\033[" + std::to_string(GRID_HEIGHT + 4) + ";1H\033[Ktick " + std::to_string(view.tick)
+                + "  layers redrawn " + std::to_string(frame.redrawn) + ", reused " + std::to_string(frame.reused);
+            std::cout << _out << std::flush;
+        }
+
+        [[nodiscard]] const LayerCache &getLayers() const { return _layers; }
+
+    private:
+        enum Layer : std::size_t { FRAME, PIPES, BIRD, HUD, LAYER_COUNT };
+
+        struct Cells {
+            int left;
+            int top;
+            int right;
+            int bottom;
+        };
+
+        static int column(const float x) { return static_cast<int>(x * GRID_WIDTH / GameRules::SCREEN_WIDTH); }
+        static int line(const float y) { return static_cast<int>(y * GRID_HEIGHT / GameRules::GROUND); }
+
+        static Cells pipeCells(const PipeSnapshot &pipe, const bool lower)
+        {
+            const float top = lower ? pipe.gapBottom() : pipe.gapTop() - GameRules::PIPE_HEIGHT;
+            return {column(pipe.x), line(top), column(pipe.x + GameRules::PIPE_WIDTH) - 1, line(top + GameRules::PIPE_HEIGHT) - 1};
+        }
+
+        static Cells birdCells(const GameSnapshot &view)
+        {
+            return {column(view.birdX), line(view.birdY), column(view.birdX + GameRules::BIRD_WIDTH) - 1,
+                line(view.birdY + GameRules::BIRD_HEIGHT) - 1};
+        }
+
+        static std::uint64_t pipesFingerprint(const GameSnapshot &view)
+        {
+            // Pipes move every tick but only change the picture when they cross a cell.
+            std::uint64_t hash = Hash::FNV_OFFSET;
+            for (std::uint8_t i = 0; i < view.pipeCount; i++) {
+                hash = Hash::combine(Hash::combine(hash, pipeCells(view.pipes[i], false)), pipeCells(view.pipes[i], true));
+            }
+            return hash;
+        }
+
+        static std::uint64_t birdFingerprint(const GameSnapshot &view)
+        {
+            return Hash::combine(Hash::combine(Hash::FNV_OFFSET, birdCells(view)), view.birdDead);
+        }
+
+        static void fill(char (&grid)[GRID_HEIGHT][GRID_WIDTH], const Cells &cells, const char c)
+        {
+            for (int y = std::max(cells.top, 0); y <= std::min(cells.bottom, GRID_HEIGHT - 1); y++) {
+                for (int x = std::max(cells.left, 0); x <= std::min(cells.right, GRID_WIDTH - 1); x++) {
+                    grid[y][x] = c;
+                }
+            }
+        }
+
+        void drawFrame()
+        {
+            const std::string border = "+" + std::string(GRID_WIDTH, '-') + "+";
+            _out += "\033[H\033[2J\033[2;1H" + border + "\033[" + std::to_string(GRID_HEIGHT + 3) + ";1H" + border;
+            for (int y = 0; y < GRID_HEIGHT; y++) {
+                _out += "\033[" + std::to_string(y + 3) + ";1H|\033[" + std::to_string(GRID_WIDTH + 2) + "G|";
+            }
+            // The screen was cleared, every cached row has to be written again.
+            std::memset(_screen, ' ', sizeof(_screen));
+            _layers.invalidate(PIPES);
+            _layers.invalidate(BIRD);
+            _layers.invalidate(HUD);
+        }
+
+        void drawPipes(const GameSnapshot &view)
+        {
+            std::memset(_pipes, ' ', sizeof(_pipes));
+            for (std::uint8_t i = 0; i < view.pipeCount; i++) {
+                fill(_pipes, pipeCells(view.pipes[i], false), '#');
+                fill(_pipes, pipeCells(view.pipes[i], true), '#');
+            }
+        }
+
+        void drawBird(const GameSnapshot &view)
+        {
+            _bird = birdCells(view);
+            _birdGlyph = view.birdDead ? 'x' : '@';
+        }
+
+        void composeField()
+        {
+            char field[GRID_HEIGHT][GRID_WIDTH];
+            std::memcpy(field, _pipes, sizeof(field));
+            fill(field, _bird, _birdGlyph);
+            for (int y = 0; y < GRID_HEIGHT; y++) {
+                if (std::memcmp(field[y], _screen[y], GRID_WIDTH) == 0) {
+                    continue;
+                }
+                std::memcpy(_screen[y], field[y], GRID_WIDTH);
+                _out += "\033[" + std::to_string(y + 3) + ";2H";
+                _out.append(field[y], GRID_WIDTH);
+            }
+        }
+
+        LayerCache _layers {LAYER_COUNT}; ///< Dirty tracking of the layers
+        char _pipes[GRID_HEIGHT][GRID_WIDTH] {}; ///< Cached pipes layer
+        Cells _bird {}; ///< Cached bird layer
+        char _birdGlyph = '@'; ///< Glyph of the bird layer
+        char _screen[GRID_HEIGHT][GRID_WIDTH] {}; ///< Field rows currently on screen
+        std::string _out; ///< Escape sequences of the frame
+    };
+
+    void logEvents(const SpectatorDecoder &decoder)
+    {
+        const std::uint8_t flags = decoder.getLastFlags();
+        const GameSnapshot &view = decoder.getView();
+        if ((flags & SpectatorProtocol::FLAG_PIPES_SPAWNED) != 0) {
+            std::cout << "tick " << view.tick << ": pipes spawned, " << static_cast<int>(view.pipeCount) << " live\n";
+        }
+        if ((flags & SpectatorProtocol::FLAG_SCORE) != 0) {
+            std::cout << "tick " << view.tick << ": score " << view.score << "\n";
+        }
+        if ((flags & SpectatorProtocol::FLAG_BIRD_DIED) != 0) {
+            std::cout << "tick " << view.tick << ": bird_died at y " << view.birdY << ", final score " << view.score << "\n";
+        }
+    }
+
+    int watch(const ViewerOptions &options)
+    {
+        const int fd = openSource(options);
+        SpectatorDecoder decoder;
+        TerminalView view;
+        std::vector<std::uint8_t> buffer;
+        std::uint8_t chunk[4096];
+        bool headerRead = false;
+        std::uint64_t totalBytes = 0;
+        std::uint64_t records = 0;
+        std::uint64_t keyframes = 0;
+        auto next = std::chrono::steady_clock::now();
+
+        for (ssize_t received = read(fd, chunk, sizeof(chunk)); received > 0; received = read(fd, chunk, sizeof(chunk))) {
+            totalBytes += static_cast<std::uint64_t>(received);
+            buffer.insert(buffer.end(), chunk, chunk + received);
+            std::size_t offset = 0;
+            if (!headerRead) {
+                offset = decoder.readHeader(buffer.data(), buffer.size());
+                headerRead = offset > 0;
+            }
+            while (headerRead) {
+                const std::size_t consumed = decoder.readRecord(buffer.data() + offset, buffer.size() - offset);
+                if (consumed == 0) {
+                    break;
+                }
+                offset += consumed;
+                records++;
+                keyframes += (decoder.getLastFlags() & SpectatorProtocol::FLAG_KEYFRAME) != 0 ? 1 : 0;
+                if (!decoder.isSynchronized()) {
+                    continue;
+                }
+                if (options.draw) {
+                    view.draw(decoder.getView());
+                } else {
+                    logEvents(decoder);
+                }
+                if (options.realtime && !options.listen) {
+                    next += std::chrono::microseconds(1000000 / decoder.getTickRate());
+                    std::this_thread::sleep_until(next);
+                }
+            }
+            buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(offset));
+        }
+        close(fd);
+        if (!headerRead) {
+            throw std::runtime_error("Stream ended before its header");
+        }
+        const double seconds = static_cast<double>(records) / decoder.getTickRate();
+        std::cout << (options.draw ? "\n" : "") << records << " ticks (" << seconds << " s), " << keyframes << " keyframes, "
+            << totalBytes << " bytes, " << (seconds > 0 ? totalBytes / seconds : 0) << " bytes/s" << std::endl;
+        if (const LayerCache &layers = view.getLayers(); layers.getFrames() > 0) {
+            const LayerStats &total = layers.getTotalStats();
+            std::cout << layers.getFrames() << " frames drawn, layers redrawn " << total.redrawn << ", reused " << total.reused
+                << " (" << static_cast<double>(total.redrawn) / layers.getFrames() << " redrawn per frame)" << std::endl;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        return watch(parseOptions(argc, argv));
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** MappedFile.cpp
+*/
+
+#include "MappedFile.hpp"
+#include <stdexcept>
+#ifdef _WIN32
+ #include <fstream>
+ #include <iterator>
+#else
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+#endif // _WIN32
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    _copy.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    _data = _copy.data();
+    _size = _copy.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+MappedFile::MappedFile(const std::string &path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat info {};
+    if (fstat(fd, &info) < 0) {
+        close(fd);
+        throw std::runtime_error("Cannot stat " + path);
+    }
+    _size = static_cast<std::size_t>(info.st_size);
+    if (_size > 0) {
+        void *mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Cannot map " + path);
+        }
+        _data = static_cast<const std::uint8_t *>(mapping);
+    }
+    // The mapping stays valid once the descriptor is closed.
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data != nullptr) {
+        munmap(const_cast<std::uint8_t *>(_data), _size);
+    }
+}
+
+#endif // _WIN32
@@ -0,0 +1,72 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** MappedFile.hpp
+*/
+
+#ifndef STELLARFORGE_MAPPEDFILE_HPP
+#define STELLARFORGE_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole file, memory-mapped where the platform allows it.
+ *
+ * On Windows the file is read into memory instead.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Maps a file.
+     * @param path Path of the file.
+     * @throw std::runtime_error If the file cannot be opened or mapped.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit MappedFile(const std::string &path);
+
+    /**
+     * @brief Unmaps the file.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Gets the content of the file.
+     * @return The first byte of the file.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const std::uint8_t *data() const { return _data; }
+
+    /**
+     * @brief Gets the size of the file.
+     * @return The size in bytes.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return _size; }
+
+private:
+    const std::uint8_t *_data = nullptr; ///< Mapped content
+    std::size_t _size = 0; ///< Size of the content
+    std::vector<std::uint8_t> _copy; ///< Content read into memory where mapping is not available
+};
+
+#endif // STELLARFORGE_MAPPEDFILE_HPP
@@ -0,0 +1,89 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** PipePairTexture.cpp
+*/
+
+#include "PipePairTexture.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include "src/sim/GameRules.hpp"
+
+namespace {
+    // Reads the image height from the PNG header, so an up to date pair is not decoded for nothing.
+    bool pngHeight(const std::string &path, unsigned &height)
+    {
+        std::ifstream file(path, std::ios::binary);
+        unsigned char header[24];
+        if (!file.read(reinterpret_cast<char *>(header), sizeof(header)) || std::memcmp(header + 12, "IHDR", 4) != 0) {
+            return false;
+        }
+        height = (static_cast<unsigned>(header[20]) << 24) | (static_cast<unsigned>(header[21]) << 16)
+            | (static_cast<unsigned>(header[22]) << 8) | static_cast<unsigned>(header[23]);
+        return true;
+    }
+
+    bool isCurrent(const std::string &pipePath, const std::string &pairPath, const unsigned height)
+    {
+        std::error_code error;
+        const auto pipeTime = std::filesystem::last_write_time(pipePath, error);
+        if (error) {
+            return false;
+        }
+        const auto pairTime = std::filesystem::last_write_time(pairPath, error);
+        unsigned written = 0;
+        return !error && pairTime >= pipeTime && pngHeight(pairPath, written) && written == height;
+    }
+}
+
+unsigned PipePairTexture::height(const float gapHeight)
+{
+    return static_cast<unsigned>(std::lround(gapHeight + 2 * GameRules::PIPE_HEIGHT));
+}
+
+bool PipePairTexture::update(const std::string &pipePath, const std::string &pairPath, const float gapHeight)
+{
+    const unsigned pairHeight = height(gapHeight);
+    if (isCurrent(pipePath, pairPath, pairHeight)) {
+        return false;
+    }
+    sf::Image pipe;
+    if (!pipe.loadFromFile(pipePath)) {
+        throw std::runtime_error("Cannot decode " + pipePath);
+    }
+    const unsigned width = pipe.getSize().x;
+    const unsigned pipeHeight = pipe.getSize().y;
+    if (pipeHeight > pairHeight) {
+        throw std::runtime_error(pipePath + " is higher than a pipe pair");
+    }
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+    const std::uint8_t *source = pipe.getPixelsPtr();
+    // Pixels are copied rather than blended, the gap stays fully transparent.
+    std::vector<std::uint8_t> pixels(stride * pairHeight, 0);
+    std::memcpy(pixels.data(), source, stride * pipeHeight);
+    std::uint8_t *lower = pixels.data() + stride * (pairHeight - pipeHeight);
+    for (unsigned row = 0; row < pipeHeight; row++) {
+        const std::uint8_t *from = source + stride * (pipeHeight - 1 - row);
+        std::uint8_t *to = lower + stride * row;
+        for (unsigned column = 0; column < width; column++) {
+            std::memcpy(to + static_cast<std::size_t>(column) * 4, from + static_cast<std::size_t>(width - 1 - column) * 4, 4);
+        }
+    }
+    sf::Image pair;
+    pair.create(width, pairHeight, pixels.data());
+    std::error_code error;
+    if (const auto directory = std::filesystem::path(pairPath).parent_path(); !directory.empty()) {
+        std::filesystem::create_directories(directory, error);
+    }
+    if (error || !pair.saveToFile(pairPath)) {
+        throw std::runtime_error("Cannot write " + pairPath);
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** PipePairTexture.hpp
+*/
+
+#ifndef STELLARFORGE_PIPEPAIRTEXTURE_HPP
+#define STELLARFORGE_PIPEPAIRTEXTURE_HPP
+
+#include <string>
+
+/**
+ * @class PipePairTexture
+ * @brief Builds the single texture a pipe pair object is drawn with.
+ *
+ * A Sprite draws one quad, so the pair texture stacks the pipe, a transparent
+ * gap and the pipe turned by 180 degrees. Each pipe is anchored
+ * GameRules::PIPE_HEIGHT away from the gap, like the software renderer draws
+ * them, so the texture is gap + 2 * PIPE_HEIGHT pixels high. It is written
+ * under .cache, next to the other generated data, so the assets directory
+ * can stay read-only; Pipe.json points its Sprite at PAIR_PATH.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class PipePairTexture {
+public:
+    static constexpr const char *PAIR_PATH = ".cache/pipe_pair.png"; ///< Pair texture drawn by the Pipe object
+
+    /**
+     * @brief Writes the pair texture if it is missing, older than the pipe or built for another gap.
+     * @param pipePath Path of the single pipe PNG, its cap at the bottom.
+     * @param pairPath Path of the pair PNG to write, its directory is created if missing.
+     * @param gapHeight Height of the gap between the two pipes.
+     * @return True if the pair texture was written, false if it was up to date.
+     * @throw std::runtime_error If the pipe cannot be decoded or the pair cannot be written.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static bool update(const std::string &pipePath, const std::string &pairPath, float gapHeight);
+
+    /**
+     * @brief Gets the height of the pair texture for a gap.
+     * @param gapHeight Height of the gap between the two pipes.
+     * @return Height of the texture in pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static unsigned height(float gapHeight);
+};
+
+#endif // STELLARFORGE_PIPEPAIRTEXTURE_HPP
@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SceneAssets.cpp
+*/
+
+#include "SceneAssets.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    std::string readFile(const std::filesystem::path &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Cannot read " + path.string());
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    // Reads the string following "key": at or after position, returns false once there are no more.
+    bool nextValue(const std::string &json, const std::string &key, std::size_t &position, std::string &value)
+    {
+        const std::string quoted = "\"" + key + "\"";
+        for (position = json.find(quoted, position); position != std::string::npos; position = json.find(quoted, position)) {
+            position += quoted.size();
+            const std::size_t colon = json.find_first_not_of(" \t\r\n", position);
+            if (colon == std::string::npos || json[colon] != ':') {
+                continue;
+            }
+            const std::size_t open = json.find_first_not_of(" \t\r\n", colon + 1);
+            if (open == std::string::npos || json[open] != '"') {
+                continue;
+            }
+            const std::size_t close = json.find('"', open + 1);
+            if (close == std::string::npos) {
+                return false;
+            }
+            value = json.substr(open + 1, close - open - 1);
+            position = close + 1;
+            return true;
+        }
+        return false;
+    }
+
+    std::vector<std::string> sceneObjectIds(const std::string &scene)
+    {
+        std::vector<std::string> ids;
+        const std::size_t list = scene.find("\"objects\"");
+        const std::size_t open = scene.find('[', list);
+        const std::size_t close = scene.find(']', open);
+        if (list == std::string::npos || open == std::string::npos || close == std::string::npos) {
+            return ids;
+        }
+        for (std::size_t quote = scene.find('"', open); quote < close; quote = scene.find('"', quote)) {
+            const std::size_t end = scene.find('"', quote + 1);
+            ids.push_back(scene.substr(quote + 1, end - quote - 1));
+            quote = end + 1;
+        }
+        return ids;
+    }
+
+    // Collects the values of a key in every object file, starting at a section of the file if given.
+    std::map<std::string, std::vector<std::string>> valuesById(const std::string &objectsDirectory, const std::string &section, const std::string &key)
+    {
+        std::map<std::string, std::vector<std::string>> values;
+        for (const auto &entry : std::filesystem::directory_iterator(objectsDirectory)) {
+            if (entry.path().extension() != ".json") {
+                continue;
+            }
+            const std::string object = readFile(entry.path());
+            std::size_t position = 0;
+            std::string id;
+            if (!nextValue(object, "id", position, id)) {
+                continue;
+            }
+            if (!section.empty() && (position = object.find("\"" + section + "\"", position)) == std::string::npos) {
+                continue;
+            }
+            std::string value;
+            while (nextValue(object, key, position, value)) {
+                values[id].push_back(value);
+            }
+        }
+        return values;
+    }
+
+    std::vector<std::string> inSceneOrder(const std::string &scenePath, std::map<std::string, std::vector<std::string>> &byId)
+    {
+        std::vector<std::string> values;
+        for (const auto &id : sceneObjectIds(readFile(scenePath))) {
+            for (const auto &value : byId[id]) {
+                if (std::find(values.begin(), values.end(), value) == values.end()) {
+                    values.push_back(value);
+                }
+            }
+        }
+        return values;
+    }
+}
+
+std::vector<std::string> SceneAssets::componentNames(const std::string &scenePath, const std::string &objectsDirectory)
+{
+    // Component entries are the only "name" keys after "components"; the object name sits in "meta" before it.
+    auto components = valuesById(objectsDirectory, "components", "name");
+    return inSceneOrder(scenePath, components);
+}
@@ -0,0 +1,36 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SceneAssets.hpp
+*/
+
+#ifndef STELLARFORGE_SCENEASSETS_HPP
+#define STELLARFORGE_SCENEASSETS_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * @class SceneAssets
+ * @brief Lists what a scene needs before the engine loads it.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SceneAssets {
+public:
+    /**
+     * @brief Collects the component names used by the objects of a scene.
+     * @param scenePath Path of the scene JSON file.
+     * @param objectsDirectory Directory of the object JSON files.
+     * @return Component names, without duplicates, in scene order.
+     * @throw std::runtime_error If the scene cannot be read.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static std::vector<std::string> componentNames(const std::string &scenePath, const std::string &objectsDirectory);
+};
+
+#endif // STELLARFORGE_SCENEASSETS_HPP
@@ -0,0 +1,221 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** TextureCache.cpp
+*/
+
+#include "TextureCache.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include "src/utils/Hash.hpp"
+#include "src/utils/Startup.hpp"
+
+namespace {
+    constexpr char CACHE_MAGIC[4] = {'F', 'B', 'T', 'X'};
+    constexpr std::uint32_t CACHE_VERSION = 1;
+
+    struct CacheHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t width;
+        std::uint32_t height;
+    };
+
+    std::string cacheDirectoryFromEnvironment()
+    {
+        const char *directory = std::getenv("FLAPPY_TEXTURE_CACHE");
+        if (directory == nullptr || *directory == '\0') {
+            return TextureCache::DEFAULT_DIRECTORY;
+        }
+        return std::string(directory) == "off" ? std::string() : std::string(directory);
+    }
+
+    std::vector<std::uint8_t> readFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Cannot read " + path);
+        }
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+}
+
+TextureCache &TextureCache::getInstance()
+{
+    static TextureCache instance(cacheDirectoryFromEnvironment());
+    return instance;
+}
+
+TextureCache::TextureCache(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+void TextureCache::preload(const std::vector<std::string> &paths)
+{
+    for (const auto &path : paths) {
+        schedule(path);
+    }
+}
+
+std::shared_ptr<const DecodedTexture> TextureCache::get(const std::string &path)
+{
+    return schedule(path).get();
+}
+
+std::shared_ptr<const DecodedTexture> TextureCache::tryGet(const std::string &path)
+{
+    try {
+        return get(path);
+    } catch (const std::runtime_error &) {
+        return nullptr;
+    }
+}
+
+void TextureCache::wait()
+{
+    std::vector<Entry> entries;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto &entry : _entries) {
+            entries.push_back(entry.second);
+        }
+    }
+    for (const auto &entry : entries) {
+        entry.wait();
+    }
+}
+
+TextureCacheStats TextureCache::getStats() const
+{
+    TextureCacheStats stats;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        stats.requested = static_cast<std::uint32_t>(_entries.size());
+    }
+    stats.ready = _ready;
+    stats.decoded = _decoded;
+    stats.mapped = _mapped;
+    stats.failed = _failed;
+    stats.readyAt = _readyAt;
+    stats.diskCache = !_directory.empty();
+    return stats;
+}
+
+TextureCache::Entry TextureCache::schedule(const std::string &path)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    if (const auto found = _entries.find(path); found != _entries.end()) {
+        return found->second;
+    }
+    if (!_pool) {
+        _pool = std::make_unique<ThreadPool>();
+    }
+    Entry entry = _pool->submit([this, path]() {
+        try {
+            auto texture = load(path);
+            _ready++;
+            const double now = Startup::millisecondsSinceLaunch();
+            for (double last = _readyAt; last < now && !_readyAt.compare_exchange_weak(last, now);) {
+            }
+            return texture;
+        } catch (...) {
+            _failed++;
+            throw;
+        }
+    }).share();
+    _entries.emplace(path, entry);
+    return entry;
+}
+
+std::shared_ptr<const DecodedTexture> TextureCache::load(const std::string &path)
+{
+    const std::vector<std::uint8_t> png = readFile(path);
+    std::string cachePath;
+    if (!_directory.empty()) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.rgba", static_cast<unsigned long long>(Hash::bytes(png.data(), png.size())));
+        cachePath = (std::filesystem::path(_directory) / name).string();
+        if (auto texture = map(cachePath)) {
+            _mapped++;
+            return texture;
+        }
+    }
+    sf::Image image;
+    if (!image.loadFromMemory(png.data(), png.size())) {
+        throw std::runtime_error("Cannot decode " + path);
+    }
+    auto texture = std::make_shared<DecodedTexture>();
+    texture->width = image.getSize().x;
+    texture->height = image.getSize().y;
+    texture->storage.assign(image.getPixelsPtr(), image.getPixelsPtr() + static_cast<std::size_t>(texture->width) * texture->height * 4);
+    texture->pixels = texture->storage.data();
+    _decoded++;
+    if (!cachePath.empty()) {
+        store(cachePath, *texture);
+    }
+    return texture;
+}
+
+std::shared_ptr<const DecodedTexture> TextureCache::map(const std::string &cachePath)
+{
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(cachePath, error)) {
+        return nullptr;
+    }
+    auto mapping = std::make_unique<MappedFile>(cachePath);
+    CacheHeader header {};
+    if (mapping->size() < sizeof(header)) {
+        return nullptr;
+    }
+    std::memcpy(&header, mapping->data(), sizeof(header));
+    const std::size_t pixelBytes = static_cast<std::size_t>(header.width) * header.height * 4;
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION
+        || mapping->size() != sizeof(header) + pixelBytes) {
+        return nullptr;
+    }
+    auto texture = std::make_shared<DecodedTexture>();
+    texture->width = header.width;
+    texture->height = header.height;
+    texture->pixels = mapping->data() + sizeof(header);
+    texture->mapped = true;
+    texture->mapping = std::move(mapping);
+    return texture;
+}
+
+void TextureCache::store(const std::string &cachePath, const DecodedTexture &texture)
+{
+    // A missing cache only costs a decode on the next run, so write failures are not errors.
+    std::error_code error;
+    std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), error);
+    const std::string temporary = cachePath + ".tmp" + std::to_string(reinterpret_cast<std::uintptr_t>(&texture));
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return;
+        }
+        CacheHeader header {};
+        std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.width = texture.width;
+        header.height = texture.height;
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(texture.pixels), static_cast<std::streamsize>(texture.storage.size()));
+        if (!file) {
+            file.close();
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, cachePath, error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+    }
+}
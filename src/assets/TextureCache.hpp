@@ -0,0 +1,192 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** TextureCache.hpp
+*/
+
+#ifndef STELLARFORGE_TEXTURECACHE_HPP
+#define STELLARFORGE_TEXTURECACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.hpp"
+#include "src/utils/ThreadPool.hpp"
+
+/**
+ * @struct DecodedTexture
+ * @brief RGBA8 pixels of a texture, decoded or mapped from the disk cache.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct DecodedTexture {
+    unsigned width = 0; ///< Width in pixels
+    unsigned height = 0; ///< Height in pixels
+    const std::uint8_t *pixels = nullptr; ///< Rows of RGBA8 pixels, top to bottom
+    bool mapped = false; ///< Pixels come from the disk cache
+    std::vector<std::uint8_t> storage; ///< Owns freshly decoded pixels
+    std::unique_ptr<MappedFile> mapping; ///< Owns pixels mapped from the disk cache
+};
+
+/**
+ * @struct TextureCacheStats
+ * @brief Outcome of the texture loads so far.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct TextureCacheStats {
+    std::uint32_t requested = 0; ///< Textures scheduled
+    std::uint32_t ready = 0; ///< Textures loaded, decoded or mapped
+    std::uint32_t decoded = 0; ///< Textures decoded from their PNG
+    std::uint32_t mapped = 0; ///< Textures mapped from the disk cache
+    std::uint32_t failed = 0; ///< Textures that could not be loaded
+    double readyAt = 0; ///< Milliseconds since launch when the last texture was ready
+    bool diskCache = false; ///< The disk cache is enabled
+};
+
+/**
+ * @class TextureCache
+ * @brief Decodes textures in parallel and keeps their pixels for the tools drawing on the CPU.
+ *
+ * The game does not use it: the engine decodes the Sprite textures itself
+ * and exposes no hook to hand it pixels, so flappy-capture is the consumer.
+ * Decoded pixels are written to a raw cache file named after the hash of
+ * the PNG content, so later runs memory-map them instead of decoding again.
+ * The cache directory defaults to .cache/textures; the FLAPPY_TEXTURE_CACHE
+ * environment variable overrides it, and "off" disables the disk cache.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class TextureCache {
+public:
+    static constexpr const char *DEFAULT_DIRECTORY = ".cache/textures"; ///< Default raw cache location
+
+    /**
+     * @brief Gets the cache shared by the game.
+     * @return The TextureCache instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static TextureCache &getInstance();
+
+    /**
+     * @brief Constructor for the TextureCache class.
+     * @param directory Raw cache directory, empty to disable the disk cache.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit TextureCache(std::string directory);
+
+    /**
+     * @brief Schedules textures to be loaded on the worker threads.
+     * @param paths Paths of the PNG files.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void preload(const std::vector<std::string> &paths);
+
+    /**
+     * @brief Gets a texture, waiting for it if it is still loading.
+     * @param path Path of the PNG file.
+     * @return The texture pixels.
+     * @throw std::runtime_error If the texture cannot be loaded.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::shared_ptr<const DecodedTexture> get(const std::string &path);
+
+    /**
+     * @brief Gets a texture like get, but without throwing when it cannot be loaded.
+     * @param path Path of the PNG file.
+     * @return The texture pixels, or nullptr if the texture cannot be loaded.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::shared_ptr<const DecodedTexture> tryGet(const std::string &path);
+
+    /**
+     * @brief Waits for every scheduled texture.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void wait();
+
+    /**
+     * @brief Gets the outcome of the loads so far.
+     * @return The load statistics.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] TextureCacheStats getStats() const;
+
+private:
+    using Entry = std::shared_future<std::shared_ptr<const DecodedTexture>>;
+
+    /**
+     * @brief Schedules a texture unless it already is.
+     * @param path Path of the PNG file.
+     * @return The pending or finished load.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    Entry schedule(const std::string &path);
+
+    /**
+     * @brief Loads a texture from the disk cache, or decodes it and fills the disk cache.
+     * @param path Path of the PNG file.
+     * @return The texture pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::shared_ptr<const DecodedTexture> load(const std::string &path);
+
+    /**
+     * @brief Maps a raw cache file.
+     * @param cachePath Path of the raw cache file.
+     * @return The texture pixels, or nullptr if the file is missing or invalid.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static std::shared_ptr<const DecodedTexture> map(const std::string &cachePath);
+
+    /**
+     * @brief Writes a raw cache file, atomically.
+     * @param cachePath Path of the raw cache file.
+     * @param texture Decoded pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void store(const std::string &cachePath, const DecodedTexture &texture);
+
+    std::string _directory; ///< Raw cache directory, empty when disabled
+    std::unique_ptr<ThreadPool> _pool; ///< Decoding threads, started on the first preload
+    mutable std::mutex _mutex; ///< Guards the entries and the pool
+    std::unordered_map<std::string, Entry> _entries; ///< Loads by texture path
+    std::atomic<std::uint32_t> _ready {0}; ///< Textures loaded
+    std::atomic<std::uint32_t> _decoded {0}; ///< Textures decoded
+    std::atomic<std::uint32_t> _mapped {0}; ///< Textures mapped
+    std::atomic<std::uint32_t> _failed {0}; ///< Textures that failed
+    std::atomic<double> _readyAt {0}; ///< Time the last texture was ready
+};
+
+#endif // STELLARFORGE_TEXTURECACHE_HPP
@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** AllocationAudit.cpp
+*/
+
+#include "AllocationAudit.hpp"
+
+std::array<AllocationAudit::Counter, AllocationAudit::MAX_SCOPES> AllocationAudit::_counters;
+AllocationAudit::Counter AllocationAudit::_outside;
+std::atomic<std::uint64_t> AllocationAudit::_frames {0};
+std::atomic<std::uint64_t> AllocationAudit::_warmupFrames {DEFAULT_WARMUP_FRAMES};
+std::atomic<bool> AllocationAudit::_armed {false};
+thread_local const char *AllocationAudit::_current = nullptr;
+
+AllocationAudit::Scope::Scope(const char *name)
+    : _previous(_current)
+{
+    _current = name;
+}
+
+AllocationAudit::Scope::~Scope()
+{
+    _current = _previous;
+}
+
+void AllocationAudit::record(const std::size_t size) noexcept
+{
+    if (!_armed.load(std::memory_order_relaxed)) {
+        return;
+    }
+    // Runs inside operator new: only touches the static counters, never allocates.
+    Counter *counter = &_outside;
+    if (const char *name = _current; name != nullptr) {
+        for (auto &slot : _counters) {
+            const char *expected = nullptr;
+            if (slot.name.load(std::memory_order_acquire) == name
+                || slot.name.compare_exchange_strong(expected, name, std::memory_order_acq_rel)
+                || expected == name) {
+                counter = &slot;
+                break;
+            }
+        }
+    }
+    counter->count.fetch_add(1, std::memory_order_relaxed);
+    counter->bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void AllocationAudit::frame() noexcept
+{
+    if (_frames.fetch_add(1, std::memory_order_relaxed) + 1 == _warmupFrames.load(std::memory_order_relaxed)) {
+        _armed.store(true, std::memory_order_relaxed);
+    }
+}
+
+void AllocationAudit::setWarmupFrames(const std::uint64_t frames) noexcept
+{
+    _warmupFrames.store(frames, std::memory_order_relaxed);
+}
+
+bool AllocationAudit::passed() noexcept
+{
+    for (const auto &slot : _counters) {
+        if (slot.count.load(std::memory_order_relaxed) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::uint64_t AllocationAudit::allocations() noexcept
+{
+    std::uint64_t count = _outside.count.load(std::memory_order_relaxed);
+    for (const auto &slot : _counters) {
+        count += slot.count.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void AllocationAudit::report(std::ostream &out)
+{
+    const std::uint64_t frames = _frames.load(std::memory_order_relaxed);
+    const std::uint64_t warmup = _warmupFrames.load(std::memory_order_relaxed);
+    if (!_armed.load(std::memory_order_relaxed)) {
+        out << "Allocation audit: only " << frames << " frames, the warm-up needs " << warmup << "\n";
+        return;
+    }
+    out << "Allocation audit over " << frames - warmup << " frames after a warm-up of " << warmup << ":\n";
+    for (const auto &slot : _counters) {
+        if (const char *name = slot.name.load(std::memory_order_acquire); name != nullptr && slot.count.load() > 0) {
+            out << "  " << name << ": " << slot.count.load() << " allocations, " << slot.bytes.load() << " bytes\n";
+        }
+    }
+    out << "  outside components (not audited): " << _outside.count.load() << " allocations, " << _outside.bytes.load() << " bytes\n"
+        << "Allocation audit " << (passed() ? "passed" : "FAILED") << "\n";
+}
@@ -0,0 +1,157 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** AllocationAudit.hpp
+*/
+
+#ifndef STELLARFORGE_ALLOCATIONAUDIT_HPP
+#define STELLARFORGE_ALLOCATIONAUDIT_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @class AllocationAudit
+ * @brief Counts heap allocations per running component once the game is warmed up.
+ *
+ * Only built with the FLAPPY_ALLOCATION_AUDIT CMake option, which also
+ * replaces the global operator new so every allocation goes through
+ * record. Components open a Scope (see ALLOCATION_SCOPE) around their
+ * update so allocations are attributed to them, and only those fail the
+ * audit.
+ *
+ * The audit does not cover:
+ * - allocations outside every scope, made by the engine between component
+ *   updates; they are reported as "outside components" but cannot be
+ *   fixed from this repository, so they do not fail the audit;
+ * - direct malloc, calloc and realloc calls, such as those of SFML or the
+ *   engine's own C dependencies. The shared Lua interpreter is the
+ *   exception: LuaVM records its growths itself.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class AllocationAudit {
+public:
+    static constexpr std::size_t MAX_SCOPES = 32; ///< Distinct scope names tracked
+    static constexpr std::uint64_t DEFAULT_WARMUP_FRAMES = 300; ///< Frames ignored before the audit starts
+
+    /**
+     * @class Scope
+     * @brief Attributes the allocations of the current thread to a name while alive.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    class Scope {
+    public:
+        /**
+         * @brief Opens a scope.
+         * @param name Name of the component, must outlive the program (a string literal).
+         * @version v0.2.0
+         * @since v0.2.0
+         * @author Landry Gigant
+         */
+        explicit Scope(const char *name);
+
+        /**
+         * @brief Restores the enclosing scope.
+         * @version v0.2.0
+         * @since v0.2.0
+         * @author Landry Gigant
+         */
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        const char *_previous; ///< Scope open before this one
+    };
+
+    /**
+     * @brief Counts an allocation, called by the replaced operator new.
+     * @param size Number of bytes requested.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void record(std::size_t size) noexcept;
+
+    /**
+     * @brief Counts a presented frame and starts the audit at the end of the warm-up.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void frame() noexcept;
+
+    /**
+     * @brief Sets the number of frames ignored before the audit starts.
+     * @param frames Warm-up frames.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void setWarmupFrames(std::uint64_t frames) noexcept;
+
+    /**
+     * @brief Tells whether no component allocated since the warm-up.
+     * @return True if the audit passed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] static bool passed() noexcept;
+
+    /**
+     * @brief Counts the allocations since the warm-up, inside and outside every scope.
+     * @return The number of allocations.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] static std::uint64_t allocations() noexcept;
+
+    /**
+     * @brief Writes the allocations counted since the warm-up, per scope.
+     * @param out Destination stream.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void report(std::ostream &out);
+
+private:
+    /**
+     * @struct Counter
+     * @brief Allocations attributed to one scope name.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct Counter {
+        std::atomic<const char *> name {nullptr}; ///< Scope name, null while the slot is free
+        std::atomic<std::uint64_t> count {0}; ///< Allocations
+        std::atomic<std::uint64_t> bytes {0}; ///< Bytes requested
+    };
+
+    static std::array<Counter, MAX_SCOPES> _counters; ///< Counters by scope, allocated statically
+    static Counter _outside; ///< Allocations outside every scope
+    static std::atomic<std::uint64_t> _frames; ///< Frames presented
+    static std::atomic<std::uint64_t> _warmupFrames; ///< Frames ignored
+    static std::atomic<bool> _armed; ///< The warm-up is over
+    static thread_local const char *_current; ///< Scope open on this thread
+};
+
+#ifdef FLAPPY_ALLOCATION_AUDIT
+ #define ALLOCATION_SCOPE(name) const AllocationAudit::Scope allocationScope(name)
+#else
+ #define ALLOCATION_SCOPE(name) static_cast<void>(0)
+#endif // FLAPPY_ALLOCATION_AUDIT
+
+#endif // STELLARFORGE_ALLOCATIONAUDIT_HPP
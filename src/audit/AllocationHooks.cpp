@@ -0,0 +1,125 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Replacement of the global allocator for the allocation audit.
+*/
+
+#include <cstdlib>
+#include <new>
+#include "AllocationAudit.hpp"
+
+namespace {
+    void *allocate(const std::size_t size)
+    {
+        AllocationAudit::record(size);
+        if (void *memory = std::malloc(size == 0 ? 1 : size)) {
+            return memory;
+        }
+        throw std::bad_alloc();
+    }
+
+    void *allocateAligned(const std::size_t size, const std::align_val_t alignment)
+    {
+        AllocationAudit::record(size);
+        const auto bytes = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+        if (void *memory = _aligned_malloc(size == 0 ? 1 : size, bytes)) {
+            return memory;
+        }
+#else
+        void *memory = nullptr;
+        if (posix_memalign(&memory, bytes < sizeof(void *) ? sizeof(void *) : bytes, size == 0 ? 1 : size) == 0) {
+            return memory;
+        }
+#endif // _WIN32
+        throw std::bad_alloc();
+    }
+
+    void releaseAligned(void *memory) noexcept
+    {
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif // _WIN32
+    }
+}
+
+void *operator new(const std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new[](const std::size_t size)
+{
+    return allocate(size);
+}
+
+void *operator new(const std::size_t size, const std::nothrow_t &) noexcept
+{
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+void *operator new[](const std::size_t size, const std::nothrow_t &) noexcept
+{
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc &) {
+        return nullptr;
+    }
+}
+
+void *operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void *operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept
+{
+    releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::align_val_t) noexcept
+{
+    releaseAligned(memory);
+}
+
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept
+{
+    releaseAligned(memory);
+}
+
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept
+{
+    releaseAligned(memory);
+}
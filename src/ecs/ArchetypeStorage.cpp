@@ -0,0 +1,207 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ArchetypeStorage.cpp
+*/
+
+#include "ArchetypeStorage.hpp"
+#include <array>
+
+namespace {
+    using Column = std::vector<float> Archetype::*;
+
+    constexpr std::array<Column, 6> TRANSFORM_COLUMNS = {
+        &Archetype::positionX, &Archetype::positionY, &Archetype::positionZ,
+        &Archetype::previousX, &Archetype::previousY, &Archetype::previousZ
+    };
+    constexpr std::array<Column, 6> RIGIDBODY_COLUMNS = {
+        &Archetype::velocityX, &Archetype::velocityY, &Archetype::velocityZ,
+        &Archetype::accelerationX, &Archetype::accelerationY, &Archetype::accelerationZ
+    };
+
+    // Calls function on every column the archetype stores.
+    template <typename Function>
+    void forEachColumn(Archetype &archetype, Function &&function)
+    {
+        for (const Column column : TRANSFORM_COLUMNS) {
+            function(archetype.*column);
+        }
+        if ((archetype.mask & RIGIDBODY) != 0) {
+            for (const Column column : RIGIDBODY_COLUMNS) {
+                function(archetype.*column);
+            }
+        }
+    }
+}
+
+std::uint32_t ArchetypeStorage::archetypeOf(const std::uint8_t mask)
+{
+    for (std::uint32_t i = 0; i < _archetypes.size(); i++) {
+        if (_archetypes[i].mask == mask) {
+            return i;
+        }
+    }
+    _archetypes.emplace_back();
+    _archetypes.back().mask = mask;
+    return static_cast<std::uint32_t>(_archetypes.size() - 1);
+}
+
+Entity ArchetypeStorage::create(const std::uint8_t mask)
+{
+    const std::uint32_t index = archetypeOf(static_cast<std::uint8_t>(mask | TRANSFORM));
+    Archetype &archetype = _archetypes[index];
+    Entity entity;
+    if (!_free.empty()) {
+        entity = _free.back();
+        _free.pop_back();
+    } else {
+        entity = static_cast<Entity>(_locations.size());
+        _locations.emplace_back();
+    }
+    _locations[entity] = {index, static_cast<std::uint32_t>(archetype.size()), true};
+    archetype.entities.push_back(entity);
+    forEachColumn(archetype, [](std::vector<float> &column) { column.push_back(0); });
+    _alive++;
+    return entity;
+}
+
+void ArchetypeStorage::destroy(const Entity entity)
+{
+    if (entity >= _locations.size() || !_locations[entity].alive) {
+        return;
+    }
+    Location &location = _locations[entity];
+    Archetype &archetype = _archetypes[location.archetype];
+    const std::size_t last = archetype.size() - 1;
+    if (location.row != last) {
+        const Entity moved = archetype.entities[last];
+        archetype.entities[location.row] = moved;
+        const std::uint32_t row = location.row;
+        forEachColumn(archetype, [row, last](std::vector<float> &column) { column[row] = column[last]; });
+        _locations[moved].row = row;
+    }
+    archetype.entities.pop_back();
+    forEachColumn(archetype, [](std::vector<float> &column) { column.pop_back(); });
+    location.alive = false;
+    _free.push_back(entity);
+    _alive--;
+}
+
+void ArchetypeStorage::clear()
+{
+    for (auto &archetype : _archetypes) {
+        for (const Entity entity : archetype.entities) {
+            _locations[entity].alive = false;
+            _free.push_back(entity);
+        }
+        archetype.entities.clear();
+        forEachColumn(archetype, [](std::vector<float> &column) { column.clear(); });
+    }
+    _alive = 0;
+}
+
+void ArchetypeStorage::reserve(const std::uint8_t mask, const std::size_t rows)
+{
+    Archetype &archetype = _archetypes[archetypeOf(static_cast<std::uint8_t>(mask | TRANSFORM))];
+    archetype.entities.reserve(rows);
+    forEachColumn(archetype, [rows](std::vector<float> &column) { column.reserve(rows); });
+    _locations.reserve(_locations.size() + rows);
+    _free.reserve(_locations.capacity());
+}
+
+bool ArchetypeStorage::has(const Entity entity, const std::uint8_t mask) const
+{
+    return entity < _locations.size() && _locations[entity].alive
+        && (_archetypes[_locations[entity].archetype].mask & mask) == mask;
+}
+
+void ArchetypeStorage::integrate(const float dt)
+{
+    for (auto &archetype : _archetypes) {
+        if ((archetype.mask & RIGIDBODY) == 0) {
+            continue;
+        }
+        // One pass per axis over plain float arrays, which the compiler vectorizes.
+        const std::size_t rows = archetype.size();
+        const std::array<std::array<float *, 4>, 3> axes = {{
+            {archetype.positionX.data(), archetype.previousX.data(), archetype.velocityX.data(), archetype.accelerationX.data()},
+            {archetype.positionY.data(), archetype.previousY.data(), archetype.velocityY.data(), archetype.accelerationY.data()},
+            {archetype.positionZ.data(), archetype.previousZ.data(), archetype.velocityZ.data(), archetype.accelerationZ.data()}
+        }};
+        for (const auto &axis : axes) {
+            float *position = axis[0];
+            float *previous = axis[1];
+            float *velocity = axis[2];
+            const float *acceleration = axis[3];
+            for (std::size_t i = 0; i < rows; i++) {
+                previous[i] = position[i];
+                velocity[i] += acceleration[i] * dt;
+                position[i] += velocity[i] * dt;
+            }
+        }
+    }
+}
+
+Float3 TransformView::getPosition() const
+{
+    const auto &location = _storage._locations[_entity];
+    const Archetype &archetype = _storage._archetypes[location.archetype];
+    return {archetype.positionX[location.row], archetype.positionY[location.row], archetype.positionZ[location.row]};
+}
+
+Float3 TransformView::getPreviousPosition() const
+{
+    const auto &location = _storage._locations[_entity];
+    const Archetype &archetype = _storage._archetypes[location.archetype];
+    return {archetype.previousX[location.row], archetype.previousY[location.row], archetype.previousZ[location.row]};
+}
+
+Float3 TransformView::interpolate(const float alpha) const
+{
+    const Float3 current = getPosition();
+    const Float3 previous = getPreviousPosition();
+    return {previous.x + (current.x - previous.x) * alpha, previous.y + (current.y - previous.y) * alpha,
+        previous.z + (current.z - previous.z) * alpha};
+}
+
+void TransformView::setPosition(const Float3 &position)
+{
+    const auto &location = _storage._locations[_entity];
+    Archetype &archetype = _storage._archetypes[location.archetype];
+    archetype.positionX[location.row] = archetype.previousX[location.row] = position.x;
+    archetype.positionY[location.row] = archetype.previousY[location.row] = position.y;
+    archetype.positionZ[location.row] = archetype.previousZ[location.row] = position.z;
+}
+
+Float3 RigidBodyView::getVelocity() const
+{
+    const auto &location = _storage._locations[_entity];
+    const Archetype &archetype = _storage._archetypes[location.archetype];
+    return {archetype.velocityX[location.row], archetype.velocityY[location.row], archetype.velocityZ[location.row]};
+}
+
+void RigidBodyView::setVelocity(const Float3 &velocity)
+{
+    const auto &location = _storage._locations[_entity];
+    Archetype &archetype = _storage._archetypes[location.archetype];
+    archetype.velocityX[location.row] = velocity.x;
+    archetype.velocityY[location.row] = velocity.y;
+    archetype.velocityZ[location.row] = velocity.z;
+}
+
+Float3 RigidBodyView::getAcceleration() const
+{
+    const auto &location = _storage._locations[_entity];
+    const Archetype &archetype = _storage._archetypes[location.archetype];
+    return {archetype.accelerationX[location.row], archetype.accelerationY[location.row], archetype.accelerationZ[location.row]};
+}
+
+void RigidBodyView::setAcceleration(const Float3 &acceleration)
+{
+    const auto &location = _storage._locations[_entity];
+    Archetype &archetype = _storage._archetypes[location.archetype];
+    archetype.accelerationX[location.row] = acceleration.x;
+    archetype.accelerationY[location.row] = acceleration.y;
+    archetype.accelerationZ[location.row] = acceleration.z;
+}
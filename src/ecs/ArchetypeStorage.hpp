@@ -0,0 +1,352 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ArchetypeStorage.hpp
+*/
+
+#ifndef STELLARFORGE_ARCHETYPESTORAGE_HPP
+#define STELLARFORGE_ARCHETYPESTORAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using Entity = std::uint32_t; ///< Handle of an entity, stable while the entity lives
+
+/**
+ * @enum ComponentMask
+ * @brief Components an archetype stores, combined as bit flags.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+enum ComponentMask : std::uint8_t {
+    TRANSFORM = 1 << 0, ///< Position and the position one step earlier
+    RIGIDBODY = 1 << 1 ///< Velocity and acceleration, integrated by ArchetypeStorage::integrate
+};
+
+/**
+ * @struct Float3
+ * @brief Three floats read out of or written into the columns.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct Float3 {
+    float x = 0; ///< First component
+    float y = 0; ///< Second component
+    float z = 0; ///< Third component
+};
+
+/**
+ * @struct Archetype
+ * @brief Every entity with the same component set, one contiguous column per field.
+ *
+ * Rows are packed: destroying an entity moves the last row into its place,
+ * so systems walk each column from 0 to size() without gaps or branches.
+ * The columns of a component missing from the mask stay empty.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct Archetype {
+    std::uint8_t mask = 0; ///< ComponentMask flags of the rows
+    std::vector<Entity> entities; ///< Entity of each row
+    std::vector<float> positionX; ///< Transform position
+    std::vector<float> positionY; ///< Transform position
+    std::vector<float> positionZ; ///< Transform position
+    std::vector<float> previousX; ///< Transform position one step earlier
+    std::vector<float> previousY; ///< Transform position one step earlier
+    std::vector<float> previousZ; ///< Transform position one step earlier
+    std::vector<float> velocityX; ///< RigidBody velocity
+    std::vector<float> velocityY; ///< RigidBody velocity
+    std::vector<float> velocityZ; ///< RigidBody velocity
+    std::vector<float> accelerationX; ///< RigidBody acceleration
+    std::vector<float> accelerationY; ///< RigidBody acceleration
+    std::vector<float> accelerationZ; ///< RigidBody acceleration
+
+    /**
+     * @brief Gets the number of rows.
+     * @return The number of entities of the archetype.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return entities.size(); }
+};
+
+class ArchetypeStorage;
+
+/**
+ * @class TransformView
+ * @brief Transform of an entity, read from and written to its archetype columns.
+ *
+ * Holds the entity rather than a row, so it stays valid when other entities
+ * are destroyed and rows move.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class TransformView {
+public:
+    /**
+     * @brief Constructor for the TransformView class.
+     * @param storage Storage of the entity.
+     * @param entity Entity with a Transform.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    TransformView(ArchetypeStorage &storage, Entity entity) : _storage(storage), _entity(entity) {}
+
+    /**
+     * @brief Gets the position.
+     * @return The position.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] Float3 getPosition() const;
+
+    /**
+     * @brief Gets the position one step earlier.
+     * @return The previous position.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] Float3 getPreviousPosition() const;
+
+    /**
+     * @brief Gets the position between the previous step and the current one.
+     * @param alpha 0 for the previous position, 1 for the current one.
+     * @return The interpolated position.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] Float3 interpolate(float alpha) const;
+
+    /**
+     * @brief Moves the entity without interpolation, the previous position is set too.
+     * @param position New position.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setPosition(const Float3 &position);
+
+private:
+    ArchetypeStorage &_storage; ///< Storage of the entity
+    Entity _entity; ///< Viewed entity
+};
+
+/**
+ * @class RigidBodyView
+ * @brief RigidBody of an entity, read from and written to its archetype columns.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class RigidBodyView {
+public:
+    /**
+     * @brief Constructor for the RigidBodyView class.
+     * @param storage Storage of the entity.
+     * @param entity Entity with a RigidBody.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    RigidBodyView(ArchetypeStorage &storage, Entity entity) : _storage(storage), _entity(entity) {}
+
+    /**
+     * @brief Gets the velocity.
+     * @return The velocity.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] Float3 getVelocity() const;
+
+    /**
+     * @brief Sets the velocity.
+     * @param velocity New velocity.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setVelocity(const Float3 &velocity);
+
+    /**
+     * @brief Gets the acceleration.
+     * @return The acceleration.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] Float3 getAcceleration() const;
+
+    /**
+     * @brief Sets the acceleration.
+     * @param acceleration New acceleration.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setAcceleration(const Float3 &acceleration);
+
+private:
+    ArchetypeStorage &_storage; ///< Storage of the entity
+    Entity _entity; ///< Viewed entity
+};
+
+/**
+ * @class ArchetypeStorage
+ * @brief Data-oriented storage of Transforms and RigidBodies, grouped by component set.
+ *
+ * An engine object keeps its components behind pointers in a list reached
+ * with getComponent, so a system touching many objects jumps across the
+ * heap. Here the entities sharing a component set live in one Archetype,
+ * field by field in contiguous columns, and integrate walks them linearly.
+ * TransformView and RigidBodyView keep a component-like API on top. Entity
+ * handles are recycled once destroyed.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class ArchetypeStorage {
+public:
+    static constexpr Entity NO_ENTITY = std::numeric_limits<Entity>::max(); ///< Handle of no entity
+
+    /**
+     * @brief Creates an entity with zeroed components.
+     * @param mask ComponentMask flags, TRANSFORM is always added.
+     * @return The new entity.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    Entity create(std::uint8_t mask);
+
+    /**
+     * @brief Destroys an entity, the last row of its archetype takes its place. Unknown entities are ignored.
+     * @param entity Entity to destroy.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void destroy(Entity entity);
+
+    /**
+     * @brief Destroys every entity, the columns keep their capacity.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void clear();
+
+    /**
+     * @brief Reserves rows in the archetype of a component set.
+     * @param mask ComponentMask flags.
+     * @param rows Number of rows to reserve.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void reserve(std::uint8_t mask, std::size_t rows);
+
+    /**
+     * @brief Tells whether an entity is alive and has the given components.
+     * @param entity Entity to check.
+     * @param mask ComponentMask flags it must have.
+     * @return True if every flag is present.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] bool has(Entity entity, std::uint8_t mask) const;
+
+    /**
+     * @brief Gets the Transform of an entity.
+     * @param entity Entity with a Transform.
+     * @return A view of the Transform.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    TransformView transform(Entity entity) { return {*this, entity}; }
+
+    /**
+     * @brief Gets the RigidBody of an entity.
+     * @param entity Entity with a RigidBody.
+     * @return A view of the RigidBody.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    RigidBodyView rigidBody(Entity entity) { return {*this, entity}; }
+
+    /**
+     * @brief Moves every RigidBody by one step, keeping the position it leaves as the previous one.
+     * @param dt Duration of the step in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void integrate(float dt);
+
+    /**
+     * @brief Gets the number of live entities.
+     * @return The number of entities across every archetype.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return _alive; }
+
+    /**
+     * @brief Gets the archetypes created so far.
+     * @return The archetypes, in creation order.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const std::vector<Archetype> &getArchetypes() const { return _archetypes; }
+
+private:
+    friend class TransformView;
+    friend class RigidBodyView;
+
+    /**
+     * @struct Location
+     * @brief Where the components of an entity are.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct Location {
+        std::uint32_t archetype = 0; ///< Index of the archetype
+        std::uint32_t row = 0; ///< Row in the archetype
+        bool alive = false; ///< The entity exists
+    };
+
+    /**
+     * @brief Finds or creates the archetype of a component set.
+     * @param mask ComponentMask flags.
+     * @return Index of the archetype.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::uint32_t archetypeOf(std::uint8_t mask);
+
+    std::vector<Archetype> _archetypes; ///< Archetypes, in creation order
+    std::vector<Location> _locations; ///< Location by entity
+    std::vector<Entity> _free; ///< Destroyed entities to reuse
+    std::size_t _alive = 0; ///< Live entities
+};
+
+#endif // STELLARFORGE_ARCHETYPESTORAGE_HPP
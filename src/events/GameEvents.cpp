@@ -0,0 +1,84 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameEvents.cpp
+*/
+
+#include "GameEvents.hpp"
+#include <algorithm>
+
+GameEvents &GameEvents::getInstance()
+{
+    static GameEvents instance;
+    return instance;
+}
+
+GameEvents::ListenerId GameEvents::addListener(const std::string &event, Callback callback)
+{
+    auto [it, inserted] = _channels.try_emplace(event);
+    Channel &channel = it->second;
+    if (inserted) {
+        // The forwarder lives as long as the engine, so register exactly one per event name.
+        EventSystem::getInstance().registerListener(event, [this, event](const EventData &data) {
+            dispatch(event, data);
+        });
+    }
+    const ListenerId id = _nextId++;
+    (channel.dispatching ? channel.pending : channel.listeners).push_back({id, std::move(callback)});
+    _owners[id] = &channel;
+    return id;
+}
+
+void GameEvents::removeListener(const ListenerId id)
+{
+    const auto owner = _owners.find(id);
+    if (owner == _owners.end()) {
+        return;
+    }
+    Channel &channel = *owner->second;
+    _owners.erase(owner);
+    const auto matches = [id](const Listener &listener) { return listener.id == id; };
+    channel.pending.erase(std::remove_if(channel.pending.begin(), channel.pending.end(), matches), channel.pending.end());
+    if (!channel.dispatching) {
+        channel.listeners.erase(std::remove_if(channel.listeners.begin(), channel.listeners.end(), matches), channel.listeners.end());
+        return;
+    }
+    // The callback running right now may be this one, so only mark it.
+    for (auto &listener : channel.listeners) {
+        if (listener.id == id) {
+            listener.id = 0;
+            channel.dirty = true;
+        }
+    }
+}
+
+void GameEvents::dispatch(const std::string &event, const EventData &data)
+{
+    const auto it = _channels.find(event);
+    if (it == _channels.end() || it->second.dispatching) {
+        return;
+    }
+    Channel &channel = it->second;
+    channel.dispatching = true;
+    for (auto &listener : channel.listeners) {
+        if (listener.id != 0) {
+            listener.callback(data);
+        }
+    }
+    channel.dispatching = false;
+    settle(channel);
+}
+
+void GameEvents::settle(Channel &channel)
+{
+    if (channel.dirty) {
+        channel.listeners.erase(std::remove_if(channel.listeners.begin(), channel.listeners.end(),
+            [](const Listener &listener) { return listener.id == 0; }), channel.listeners.end());
+        channel.dirty = false;
+    }
+    for (auto &listener : channel.pending) {
+        channel.listeners.push_back(std::move(listener));
+    }
+    channel.pending.clear();
+}
@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameEvents.hpp
+*/
+
+#ifndef STELLARFORGE_GAMEEVENTS_HPP
+#define STELLARFORGE_GAMEEVENTS_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "StellarForge/Common/event/EventSystem.hpp"
+
+/**
+ * @class GameEvents
+ * @brief Engine events with listeners that can be removed again.
+ *
+ * The engine's EventSystem keeps every listener for the life of the
+ * process. GameEvents registers a single forwarder per event name with it
+ * and dispatches to its own listeners, which are removed by id. Listeners
+ * may be added or removed while an event is being dispatched.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class GameEvents {
+public:
+    using Callback = std::function<void(const EventData &)>; ///< Listener signature
+    using ListenerId = std::uint32_t; ///< Handle of a registered listener, never 0
+
+    /**
+     * @brief Gets the GameEvents instance.
+     * @return The GameEvents instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static GameEvents &getInstance();
+
+    GameEvents(const GameEvents &) = delete;
+    GameEvents &operator=(const GameEvents &) = delete;
+
+    /**
+     * @brief Registers a listener, forwarding the event from the engine on first use of its name.
+     * @param event Name of the event.
+     * @param callback Function called when the event is triggered.
+     * @return Id to pass to removeListener.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ListenerId addListener(const std::string &event, Callback callback);
+
+    /**
+     * @brief Removes a listener. Unknown ids are ignored.
+     * @param id Id returned by addListener.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void removeListener(ListenerId id);
+
+    /**
+     * @brief Calls the listeners of an event.
+     * @param event Name of the event.
+     * @param data Data passed to the listeners.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void dispatch(const std::string &event, const EventData &data);
+
+    /**
+     * @brief Gets the number of registered listeners.
+     * @return The number of listeners across every event.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t getListenerCount() const { return _owners.size(); }
+
+    /**
+     * @brief Gets the number of forwarders registered with the engine.
+     * @return One per event name ever listened to.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t getForwarderCount() const { return _channels.size(); }
+
+private:
+    struct Listener {
+        ListenerId id = 0; ///< Listener id, 0 once removed during a dispatch
+        Callback callback; ///< Function to call
+    };
+
+    struct Channel {
+        std::vector<Listener> listeners; ///< Listeners of the event
+        std::vector<Listener> pending; ///< Listeners added during a dispatch
+        bool dispatching = false; ///< The event is being dispatched
+        bool dirty = false; ///< A listener was removed during the dispatch
+    };
+
+    GameEvents() = default;
+
+    /**
+     * @brief Moves the listeners added during a dispatch in and drops the removed ones.
+     * @param channel Channel to settle.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void settle(Channel &channel);
+
+    std::unordered_map<std::string, Channel> _channels; ///< Listeners by event name, nodes never move
+    std::unordered_map<ListenerId, Channel *> _owners; ///< Channel of every live listener
+    ListenerId _nextId = 1; ///< Id given to the next listener
+};
+
+#endif // STELLARFORGE_GAMEEVENTS_HPP
@@ -0,0 +1,27 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ListenerScope.cpp
+*/
+
+#include "ListenerScope.hpp"
+
+ListenerScope::~ListenerScope()
+{
+    clear();
+}
+
+void ListenerScope::listen(const std::string &event, GameEvents::Callback callback)
+{
+    _ids.push_back(GameEvents::getInstance().addListener(event, std::move(callback)));
+}
+
+void ListenerScope::clear()
+{
+    auto &events = GameEvents::getInstance();
+    for (const auto id : _ids) {
+        events.removeListener(id);
+    }
+    _ids.clear();
+}
@@ -0,0 +1,71 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ListenerScope.hpp
+*/
+
+#ifndef STELLARFORGE_LISTENERSCOPE_HPP
+#define STELLARFORGE_LISTENERSCOPE_HPP
+
+#include <string>
+#include <vector>
+#include "GameEvents.hpp"
+
+/**
+ * @class ListenerScope
+ * @brief Owns the event listeners of a component and removes them together.
+ *
+ * Components capture `this` in their listeners, so they clear the scope in
+ * end(). The destructor clears it too in case end() is never called.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class ListenerScope {
+public:
+    ListenerScope() = default;
+
+    /**
+     * @brief Removes the listeners still registered.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~ListenerScope();
+
+    ListenerScope(const ListenerScope &) = delete;
+    ListenerScope &operator=(const ListenerScope &) = delete;
+
+    /**
+     * @brief Registers a listener owned by this scope.
+     * @param event Name of the event.
+     * @param callback Function called when the event is triggered.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void listen(const std::string &event, GameEvents::Callback callback);
+
+    /**
+     * @brief Removes every listener owned by this scope.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of listeners owned by this scope.
+     * @return The number of listeners.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return _ids.size(); }
+
+private:
+    std::vector<GameEvents::ListenerId> _ids; ///< Listeners owned by the scope
+};
+
+#endif // STELLARFORGE_LISTENERSCOPE_HPP
@@ -0,0 +1,345 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Leaderboard.cpp
+*/
+
+#include "Leaderboard.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#ifdef _WIN32
+ #include <fcntl.h>
+ #include <io.h>
+#else
+ #include <fcntl.h>
+ #include <unistd.h>
+#endif // _WIN32
+
+namespace {
+    constexpr char CHECKPOINT_MAGIC[8] = {'F', 'L', 'A', 'P', 'I', 'D', 'X', '1'};
+
+    // Fixed part of the checkpoint, followed by the top results and the histogram.
+    struct CheckpointHeader {
+        char magic[8];
+        std::uint32_t recordSize;
+        std::uint32_t topCount;
+        std::uint64_t nextGeneration;
+        std::uint64_t results;
+        std::uint64_t compactions;
+        std::uint64_t histogramSize;
+    };
+
+    std::string directoryFromEnvironment()
+    {
+        const char *directory = std::getenv("FLAPPY_LEADERBOARD_DIR");
+        if (directory == nullptr || *directory == '\0') {
+            return Leaderboard::DEFAULT_DIRECTORY;
+        }
+        return std::string(directory) == "off" ? std::string() : std::string(directory);
+    }
+
+    // Flushes a file, or on POSIX a directory entry, to the disk.
+    bool syncPath(const std::filesystem::path &path, const bool directory)
+    {
+#ifdef _WIN32
+        if (directory) {
+            return true; // Windows cannot open a directory to flush it, MoveFileEx writes the rename through.
+        }
+        const int fd = _open(path.string().c_str(), _O_RDWR | _O_BINARY);
+        if (fd < 0) {
+            return false;
+        }
+        const bool synced = _commit(fd) == 0;
+        _close(fd);
+#else
+        const int fd = open(path.c_str(), directory ? O_RDONLY | O_DIRECTORY : O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        const bool synced = fsync(fd) == 0;
+        close(fd);
+#endif // _WIN32
+        return synced;
+    }
+
+    // Best score first, and a new result goes after the results it ties with.
+    bool better(const ScoreRecord &a, const ScoreRecord &b)
+    {
+        return a.score > b.score;
+    }
+}
+
+Leaderboard &Leaderboard::getInstance()
+{
+    static Leaderboard instance(directoryFromEnvironment());
+    return instance;
+}
+
+Leaderboard::Leaderboard(std::string directory, const std::uint64_t compactRecords)
+    : _directory(std::move(directory)), _compactRecords(std::max<std::uint64_t>(compactRecords, 1)),
+    _standings(std::make_shared<const Standings>())
+{
+    _top.reserve(TOP_K + 1);
+    _queue.reserve(QUEUE_RESERVE);
+    _worker = std::thread(&Leaderboard::work, this);
+}
+
+Leaderboard::~Leaderboard()
+{
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    _worker.join();
+}
+
+void Leaderboard::submit(const ScoreRecord &record)
+{
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back(record);
+        _queue.back().reserved = 0;
+        _submitted++;
+    }
+    _wake.notify_one();
+}
+
+void Leaderboard::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    const std::uint64_t target = _submitted;
+    _applied.wait(lock, [this, target]() { return _loaded && _done >= target; });
+}
+
+std::shared_ptr<const Leaderboard::Standings> Leaderboard::standings() const
+{
+    return std::atomic_load(&_standings);
+}
+
+std::vector<ScoreRecord> Leaderboard::top(const std::size_t count) const
+{
+    const auto current = standings();
+    const std::size_t size = std::min(count, current->top.size());
+    return {current->top.begin(), current->top.begin() + static_cast<std::ptrdiff_t>(size)};
+}
+
+std::uint32_t Leaderboard::best() const
+{
+    const auto current = standings();
+    return current->top.empty() ? 0 : current->top.front().score;
+}
+
+double Leaderboard::rankOf(const std::uint32_t score) const
+{
+    const auto current = standings();
+    const std::uint32_t slot = std::min(score, MAX_RANKED_SCORE);
+    if (current->stats.results == 0 || slot == 0 || current->atOrBelow.empty()) {
+        return 0;
+    }
+    const std::size_t below = std::min<std::size_t>(slot - 1, current->atOrBelow.size() - 1);
+    return static_cast<double>(current->atOrBelow[below]) / static_cast<double>(current->stats.results);
+}
+
+std::uint32_t Leaderboard::scoreAt(const double quantile) const
+{
+    const auto current = standings();
+    if (current->stats.results == 0) {
+        return 0;
+    }
+    const double share = std::clamp(quantile, 0.0, 1.0);
+    const auto wanted = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(share * static_cast<double>(current->stats.results))));
+    const auto found = std::lower_bound(current->atOrBelow.begin(), current->atOrBelow.end(), wanted);
+    return static_cast<std::uint32_t>(found - current->atOrBelow.begin());
+}
+
+LeaderboardStats Leaderboard::getStats() const
+{
+    return standings()->stats;
+}
+
+void Leaderboard::work()
+{
+    load();
+    publish();
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _loaded = true;
+    }
+    _applied.notify_all();
+    std::vector<ScoreRecord> batch;
+    batch.reserve(QUEUE_RESERVE);
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+            if (_queue.empty()) {
+                return;
+            }
+            batch.swap(_queue);
+        }
+        for (const auto &record : batch) {
+            if (_log) {
+                try {
+                    _log->append(record);
+                } catch (const std::exception &e) {
+                    std::cerr << "Leaderboard: " << e.what() << ", later results are kept in memory" << std::endl;
+                    _log.reset();
+                    _stats.persistent = false;
+                }
+            }
+            rank(record);
+        }
+        if (_log) {
+            _stats.logged = _log->size();
+            if (_stats.logged >= _compactRecords) {
+                compact();
+            }
+            _log->sync();
+        }
+        publish();
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            _done += batch.size();
+        }
+        _applied.notify_all();
+        batch.clear();
+    }
+}
+
+void Leaderboard::load()
+{
+    if (_directory.empty()) {
+        return;
+    }
+    try {
+        std::filesystem::create_directories(_directory);
+        const std::uint64_t nextGeneration = readCheckpoint();
+        _log = std::make_unique<ScoreLog>((std::filesystem::path(_directory) / LOG_FILE).string());
+        if (_log->getGeneration() < nextGeneration) {
+            // The checkpoint was written but the log was not emptied yet, its results are already counted.
+            _log->reset(nextGeneration);
+        }
+        const ScoreRecord *records = _log->records();
+        for (std::uint64_t i = 0; i < _log->size(); i++) {
+            rank(records[i]);
+        }
+        _stats.logged = _log->size();
+        _stats.generation = _log->getGeneration();
+        _stats.persistent = true;
+    } catch (const std::exception &e) {
+        std::cerr << "Leaderboard: " << e.what() << ", results are kept in memory" << std::endl;
+        _log.reset();
+        _top.clear();
+        _histogram.clear();
+        _stats = LeaderboardStats();
+    }
+}
+
+void Leaderboard::rank(const ScoreRecord &record)
+{
+    const std::uint32_t slot = std::min(record.score, MAX_RANKED_SCORE);
+    if (slot >= _histogram.size()) {
+        _histogram.resize(slot + 1, 0);
+    }
+    _histogram[slot]++;
+    _stats.results++;
+    if (_top.size() < TOP_K || record.score > _top.back().score) {
+        _top.insert(std::upper_bound(_top.begin(), _top.end(), record, better), record);
+        if (_top.size() > TOP_K) {
+            _top.pop_back();
+        }
+    }
+}
+
+void Leaderboard::compact()
+{
+    const std::filesystem::path path = std::filesystem::path(_directory) / INDEX_FILE;
+    const std::filesystem::path temporary = path.string() + ".tmp";
+    const std::uint64_t nextGeneration = _log->getGeneration() + 1;
+    CheckpointHeader header {};
+    std::memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    header.recordSize = sizeof(ScoreRecord);
+    header.topCount = static_cast<std::uint32_t>(_top.size());
+    header.nextGeneration = nextGeneration;
+    header.results = _stats.results;
+    header.compactions = _stats.compactions + 1;
+    header.histogramSize = _histogram.size();
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(_top.data()), static_cast<std::streamsize>(_top.size() * sizeof(ScoreRecord)));
+        file.write(reinterpret_cast<const char *>(_histogram.data()), static_cast<std::streamsize>(_histogram.size() * sizeof(std::uint64_t)));
+        if (!file) {
+            std::cerr << "Leaderboard: cannot write " << temporary.string() << ", the log keeps growing" << std::endl;
+            return;
+        }
+    }
+    // The checkpoint must be on the disk before the rename, or a power loss could leave an empty file in its place.
+    if (!syncPath(temporary, false)) {
+        std::cerr << "Leaderboard: cannot flush " << temporary.string() << ", the log keeps growing" << std::endl;
+        return;
+    }
+    // Renamed into place before the log is emptied: a crash in between leaves a log older than the checkpoint, which load drops.
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::cerr << "Leaderboard: cannot replace " << path.string() << ": " << error.message() << std::endl;
+        return;
+    }
+    // The rename itself must be durable before the log forgets the results the checkpoint now holds.
+    if (!syncPath(path.parent_path(), true)) {
+        std::cerr << "Leaderboard: cannot flush " << _directory << ", the log keeps growing" << std::endl;
+        return;
+    }
+    _log->reset(nextGeneration);
+    _stats.logged = 0;
+    _stats.generation = nextGeneration;
+    _stats.compactions++;
+}
+
+std::uint64_t Leaderboard::readCheckpoint()
+{
+    const std::filesystem::path path = std::filesystem::path(_directory) / INDEX_FILE;
+    std::ifstream file(path, std::ios::binary);
+    CheckpointHeader header {};
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+        return 0;
+    }
+    if (std::memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC)) != 0 || header.recordSize != sizeof(ScoreRecord)
+        || header.topCount > TOP_K || header.histogramSize > static_cast<std::uint64_t>(MAX_RANKED_SCORE) + 1) {
+        throw std::runtime_error(path.string() + " is not a leaderboard checkpoint");
+    }
+    _top.resize(header.topCount);
+    _histogram.resize(header.histogramSize);
+    file.read(reinterpret_cast<char *>(_top.data()), static_cast<std::streamsize>(_top.size() * sizeof(ScoreRecord)));
+    file.read(reinterpret_cast<char *>(_histogram.data()), static_cast<std::streamsize>(_histogram.size() * sizeof(std::uint64_t)));
+    if (!file) {
+        throw std::runtime_error(path.string() + " is truncated");
+    }
+    _stats.results = header.results;
+    _stats.compactions = header.compactions;
+    return header.nextGeneration;
+}
+
+void Leaderboard::publish()
+{
+    auto next = std::make_shared<Standings>();
+    next->top = _top;
+    next->atOrBelow.resize(_histogram.size());
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < _histogram.size(); i++) {
+        total += _histogram[i];
+        next->atOrBelow[i] = total;
+    }
+    next->stats = _stats;
+    std::atomic_store(&_standings, std::shared_ptr<const Standings>(std::move(next)));
+}
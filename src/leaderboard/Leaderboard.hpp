@@ -0,0 +1,254 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Leaderboard.hpp
+*/
+
+#ifndef STELLARFORGE_LEADERBOARD_HPP
+#define STELLARFORGE_LEADERBOARD_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ScoreLog.hpp"
+
+/**
+ * @struct LeaderboardStats
+ * @brief What the leaderboard did since it was opened.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct LeaderboardStats {
+    std::uint64_t results = 0; ///< Results ranked, including the ones loaded at start
+    std::uint64_t logged = 0; ///< Results in the log, not yet folded into the index
+    std::uint64_t compactions = 0; ///< Times the log was folded into the index
+    std::uint64_t generation = 0; ///< Generation of the log
+    bool persistent = false; ///< Results are written to disk
+};
+
+/**
+ * @class Leaderboard
+ * @brief Local high scores, kept in an append-only log and ranked in memory.
+ *
+ * submit only queues the result under a short lock, so the game loop never
+ * waits on the disk. A worker thread appends the queued results to the
+ * mapped ScoreLog and updates the index: the TOP_K best results, kept
+ * sorted, and a histogram of every score ever submitted. After each batch
+ * the worker publishes a read-only copy of the index, and queries read the
+ * latest copy without locking the worker out. When the log holds
+ * compactRecords results, the worker writes the index to a checkpoint file
+ * and empties the log. The detail of a result outside the top K is then
+ * dropped, but it still counts in the histogram. At start the worker loads
+ * the checkpoint and replays the log. Results go to the leaderboard
+ * directory, which the FLAPPY_LEADERBOARD_DIR environment variable
+ * overrides; "off" ranks the results of this run only.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class Leaderboard {
+public:
+    static constexpr const char *DEFAULT_DIRECTORY = "leaderboard"; ///< Default location of the log and checkpoint
+    static constexpr const char *LOG_FILE = "scores.log"; ///< Append-only log of the latest results
+    static constexpr const char *INDEX_FILE = "scores.index"; ///< Checkpoint of the compacted results
+    static constexpr std::size_t TOP_K = 100; ///< Best results kept in full
+    static constexpr std::uint32_t MAX_RANKED_SCORE = 65535; ///< Higher scores share the last histogram slot
+    static constexpr std::uint64_t DEFAULT_COMPACT_RECORDS = 1 << 20; ///< Log length that triggers a compaction
+    static constexpr std::size_t QUEUE_RESERVE = 256; ///< Results queued before submit allocates
+
+    /**
+     * @brief Gets the instance of the Leaderboard class.
+     * @return The leaderboard of the game, opened on first use.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static Leaderboard &getInstance();
+
+    /**
+     * @brief Constructor for the Leaderboard class, starts the worker.
+     * @param directory Directory of the log and checkpoint, empty to keep the results in memory.
+     * @param compactRecords Log length that triggers a compaction.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit Leaderboard(std::string directory, std::uint64_t compactRecords = DEFAULT_COMPACT_RECORDS);
+
+    /**
+     * @brief Applies the queued results and stops the worker.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~Leaderboard();
+
+    Leaderboard(const Leaderboard &) = delete;
+    Leaderboard &operator=(const Leaderboard &) = delete;
+
+    /**
+     * @brief Queues a result for the worker. Safe to call from any thread.
+     * @param record Result to rank, its reserved field is ignored.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void submit(const ScoreRecord &record);
+
+    /**
+     * @brief Waits until the stored results are loaded and every result submitted so far is ranked and visible to queries.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void flush();
+
+    /**
+     * @brief Gets the best results.
+     * @param count Number of results wanted, at most TOP_K are kept.
+     * @return The best results, best first. Ties are ordered oldest first.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::vector<ScoreRecord> top(std::size_t count) const;
+
+    /**
+     * @brief Gets the best score.
+     * @return The best score, 0 when nothing was ranked.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t best() const;
+
+    /**
+     * @brief Gets the share of the results a score beats.
+     * @param score Score to place.
+     * @return The share of results with a lower score, from 0 to 1.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] double rankOf(std::uint32_t score) const;
+
+    /**
+     * @brief Gets the score at a percentile.
+     * @param quantile Share of the results, from 0 to 1.
+     * @return The lowest score reached or beaten by that share of the results, 0 when nothing was ranked.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t scoreAt(double quantile) const;
+
+    /**
+     * @brief Gets what the leaderboard did so far.
+     * @return The counts of the latest published index.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] LeaderboardStats getStats() const;
+
+private:
+    /**
+     * @struct Standings
+     * @brief Read-only copy of the index that queries read.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct Standings {
+        std::vector<ScoreRecord> top; ///< Best results, best first
+        std::vector<std::uint64_t> atOrBelow; ///< Results scoring at most the index
+        LeaderboardStats stats; ///< Counts when the copy was made
+    };
+
+    /**
+     * @brief Loads the checkpoint and the log, then applies the queue until stopped.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void work();
+
+    /**
+     * @brief Opens the log and ranks what the checkpoint and the log hold.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void load();
+
+    /**
+     * @brief Adds a result to the top K and the histogram.
+     * @param record Result to rank.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void rank(const ScoreRecord &record);
+
+    /**
+     * @brief Writes the index to the checkpoint and empties the log.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void compact();
+
+    /**
+     * @brief Reads the checkpoint into the index.
+     * @return The first log generation the checkpoint does not cover, 0 without a checkpoint.
+     * @throw std::runtime_error If the checkpoint is damaged.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::uint64_t readCheckpoint();
+
+    /**
+     * @brief Copies the index into new Standings for the queries.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void publish();
+
+    /**
+     * @brief Gets the latest Standings.
+     * @return The latest copy of the index, never null.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::shared_ptr<const Standings> standings() const;
+
+    std::string _directory; ///< Directory of the log and checkpoint, empty in memory
+    std::uint64_t _compactRecords; ///< Log length that triggers a compaction
+    std::unique_ptr<ScoreLog> _log; ///< Results since the last compaction, worker only
+    std::vector<ScoreRecord> _top; ///< Best results, best first, worker only
+    std::vector<std::uint64_t> _histogram; ///< Results by score, worker only
+    LeaderboardStats _stats; ///< Counts, worker only
+    std::shared_ptr<const Standings> _standings; ///< Latest copy, read and replaced atomically
+    std::mutex _mutex; ///< Guards the queue and the counters below
+    std::condition_variable _wake; ///< Wakes the worker
+    std::condition_variable _applied; ///< Wakes flush
+    std::vector<ScoreRecord> _queue; ///< Submitted results not yet taken by the worker
+    std::uint64_t _submitted = 0; ///< Results submitted
+    std::uint64_t _done = 0; ///< Results ranked and published
+    bool _loaded = false; ///< The checkpoint and the log were ranked
+    bool _stopping = false; ///< The destructor asked the worker to stop
+    std::thread _worker; ///< Applies the queue, started last
+};
+
+#endif // STELLARFORGE_LEADERBOARD_HPP
@@ -0,0 +1,198 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ScoreLog.cpp
+*/
+
+#include "ScoreLog.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#ifdef _WIN32
+ #include <fstream>
+#else
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+#endif // _WIN32
+
+namespace {
+    constexpr char MAGIC[8] = {'F', 'L', 'A', 'P', 'L', 'O', 'G', '1'};
+}
+
+#ifdef _WIN32
+
+ScoreLog::ScoreLog(std::string path)
+    : _path(std::move(path))
+{
+    std::ifstream file(_path, std::ios::binary);
+    if (file && file.read(reinterpret_cast<char *>(&_memoryHeader), sizeof(Header))) {
+        if (std::memcmp(_memoryHeader.magic, MAGIC, sizeof(MAGIC)) != 0 || _memoryHeader.recordSize != sizeof(ScoreRecord)) {
+            throw std::runtime_error(_path + " is not a score log");
+        }
+        _memoryRecords.resize(_memoryHeader.count);
+        file.read(reinterpret_cast<char *>(_memoryRecords.data()), static_cast<std::streamsize>(_memoryHeader.count * sizeof(ScoreRecord)));
+        _memoryRecords.resize(static_cast<std::size_t>(file.gcount()) / sizeof(ScoreRecord));
+        _memoryHeader.count = _memoryRecords.size();
+    } else {
+        reset(0);
+    }
+    _header = &_memoryHeader;
+}
+
+ScoreLog::~ScoreLog() = default;
+
+void ScoreLog::append(const ScoreRecord &record)
+{
+    std::fstream file(_path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(sizeof(Header) + _memoryRecords.size() * sizeof(ScoreRecord)));
+    file.write(reinterpret_cast<const char *>(&record), sizeof(record));
+    _memoryRecords.push_back(record);
+    _memoryHeader.count = _memoryRecords.size();
+    file.seekp(0);
+    file.write(reinterpret_cast<const char *>(&_memoryHeader), sizeof(Header));
+    if (!file) {
+        throw std::runtime_error("Cannot append to " + _path);
+    }
+}
+
+void ScoreLog::reset(const std::uint64_t generation)
+{
+    std::memset(&_memoryHeader, 0, sizeof(Header));
+    std::memcpy(_memoryHeader.magic, MAGIC, sizeof(MAGIC));
+    _memoryHeader.recordSize = sizeof(ScoreRecord);
+    _memoryHeader.generation = generation;
+    _memoryRecords.clear();
+    std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&_memoryHeader), sizeof(Header));
+    if (!file) {
+        throw std::runtime_error("Cannot write " + _path);
+    }
+}
+
+void ScoreLog::sync()
+{
+}
+
+const ScoreRecord *ScoreLog::records() const
+{
+    return _memoryRecords.data();
+}
+
+void ScoreLog::map(std::uint64_t)
+{
+}
+
+#else
+
+ScoreLog::ScoreLog(std::string path)
+    : _path(std::move(path))
+{
+    _fd = open(_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (_fd < 0) {
+        throw std::runtime_error("Cannot open " + _path);
+    }
+    struct stat info {};
+    if (fstat(_fd, &info) < 0) {
+        close(_fd);
+        throw std::runtime_error("Cannot stat " + _path);
+    }
+    const auto fileSize = static_cast<std::uint64_t>(info.st_size);
+    try {
+        if (fileSize < sizeof(Header)) {
+            map(INITIAL_CAPACITY);
+            reset(0);
+            return;
+        }
+        // A file holding only its header, as the Windows reset writes, still gets room to append.
+        const std::uint64_t stored = (fileSize - sizeof(Header)) / sizeof(ScoreRecord);
+        map(std::max(stored, INITIAL_CAPACITY));
+        if (std::memcmp(_header->magic, MAGIC, sizeof(MAGIC)) != 0 || _header->recordSize != sizeof(ScoreRecord)) {
+            throw std::runtime_error(_path + " is not a score log");
+        }
+        // A count past the end of the file can only come from a torn write, keep the complete records.
+        if (_header->count > stored) {
+            _header->count = stored;
+        }
+    } catch (...) {
+        if (_header != nullptr) {
+            munmap(_header, _mappedSize);
+        }
+        close(_fd);
+        throw;
+    }
+}
+
+ScoreLog::~ScoreLog()
+{
+    if (_header != nullptr) {
+        msync(_header, _mappedSize, MS_ASYNC);
+        munmap(_header, _mappedSize);
+    }
+    close(_fd);
+}
+
+void ScoreLog::map(const std::uint64_t capacity)
+{
+    const std::size_t size = sizeof(Header) + static_cast<std::size_t>(capacity) * sizeof(ScoreRecord);
+    struct stat info {};
+    if (fstat(_fd, &info) < 0 || (static_cast<std::size_t>(info.st_size) < size && ftruncate(_fd, static_cast<off_t>(size)) < 0)) {
+        throw std::runtime_error("Cannot grow " + _path);
+    }
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Cannot map " + _path);
+    }
+    if (_header != nullptr) {
+        munmap(_header, _mappedSize);
+    }
+    _header = static_cast<Header *>(mapping);
+    _mappedSize = size;
+    _capacity = capacity;
+}
+
+void ScoreLog::append(const ScoreRecord &record)
+{
+    if (_header->count >= _capacity) {
+        map(std::max(_capacity * 2, INITIAL_CAPACITY));
+    }
+    auto *records = reinterpret_cast<ScoreRecord *>(_header + 1);
+    records[_header->count] = record;
+    _header->count++;
+}
+
+void ScoreLog::reset(const std::uint64_t generation)
+{
+    // Zeroing the count first means a crash during the reset leaves an empty log, never a mix of generations.
+    _header->count = 0;
+    std::memcpy(_header->magic, MAGIC, sizeof(MAGIC));
+    _header->recordSize = sizeof(ScoreRecord);
+    _header->reserved = 0;
+    _header->generation = generation;
+    std::memset(_header->padding, 0, sizeof(_header->padding));
+}
+
+void ScoreLog::sync()
+{
+    msync(_header, _mappedSize, MS_ASYNC);
+}
+
+const ScoreRecord *ScoreLog::records() const
+{
+    return reinterpret_cast<const ScoreRecord *>(_header + 1);
+}
+
+#endif // _WIN32
+
+std::uint64_t ScoreLog::size() const
+{
+    return _header->count;
+}
+
+std::uint64_t ScoreLog::getGeneration() const
+{
+    return _header->generation;
+}
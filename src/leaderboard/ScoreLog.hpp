@@ -0,0 +1,163 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ScoreLog.hpp
+*/
+
+#ifndef STELLARFORGE_SCORELOG_HPP
+#define STELLARFORGE_SCORELOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ScoreRecord
+ * @brief One finished game, as stored in the score log.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct ScoreRecord {
+    std::uint32_t score = 0; ///< Final score
+    std::uint32_t seed = 0; ///< State of the pipe course generator when the game started
+    std::uint32_t durationMs = 0; ///< Simulated length of the game in milliseconds
+    std::uint32_t reserved = 0; ///< Always 0, keeps the timestamp aligned
+    std::int64_t timestamp = 0; ///< Unix time of the end of the game in milliseconds
+};
+
+static_assert(sizeof(ScoreRecord) == 24, "ScoreRecord is written to disk as is");
+
+/**
+ * @class ScoreLog
+ * @brief Append-only file of ScoreRecords, memory-mapped for reading and appending.
+ *
+ * A 64-byte header holds the record count and a generation number, and the
+ * records follow. The file grows by doubling, so most appends are a copy
+ * into the mapping. The record is written before the count, so a crash
+ * loses at most the record being appended. Records are stored in the
+ * byte order of the machine. Where mapping is not available the records are
+ * kept in memory and written with file streams.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class ScoreLog {
+public:
+    static constexpr std::uint64_t INITIAL_CAPACITY = 4096; ///< Records the file is created with
+
+    /**
+     * @brief Opens a score log, creating it if missing.
+     * @param path Path of the log file.
+     * @throw std::runtime_error If the file cannot be opened, mapped or is not a score log.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit ScoreLog(std::string path);
+
+    /**
+     * @brief Unmaps and closes the log.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~ScoreLog();
+
+    ScoreLog(const ScoreLog &) = delete;
+    ScoreLog &operator=(const ScoreLog &) = delete;
+
+    /**
+     * @brief Appends a record, growing the file when it is full.
+     * @param record Record to append.
+     * @throw std::runtime_error If the file cannot grow.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void append(const ScoreRecord &record);
+
+    /**
+     * @brief Empties the log and gives it a new generation.
+     * @param generation Generation of the emptied log.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void reset(std::uint64_t generation);
+
+    /**
+     * @brief Asks the system to write the mapped pages back, without waiting.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void sync();
+
+    /**
+     * @brief Gets the records.
+     * @return The first record, valid until the next append or reset.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const ScoreRecord *records() const;
+
+    /**
+     * @brief Gets the number of records.
+     * @return The number of records appended since the last reset.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t size() const;
+
+    /**
+     * @brief Gets the generation of the log.
+     * @return The generation, incremented by every compaction.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getGeneration() const;
+
+private:
+    /**
+     * @struct Header
+     * @brief First 64 bytes of the file.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct Header {
+        char magic[8]; ///< "FLAPLOG1"
+        std::uint32_t recordSize; ///< sizeof(ScoreRecord)
+        std::uint32_t reserved; ///< Always 0
+        std::uint64_t generation; ///< Compactions folded before the first record
+        std::uint64_t count; ///< Records written
+        std::uint8_t padding[32]; ///< Up to 64 bytes
+    };
+
+    static_assert(sizeof(Header) == 64, "The header is written to disk as is");
+
+    /**
+     * @brief Maps the file with room for a number of records.
+     * @param capacity Records the file must hold.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void map(std::uint64_t capacity);
+
+    std::string _path; ///< Path of the log file
+    Header *_header = nullptr; ///< Mapped header
+    std::uint64_t _capacity = 0; ///< Records the mapping holds
+    std::size_t _mappedSize = 0; ///< Bytes mapped
+    int _fd = -1; ///< Open log file
+    Header _memoryHeader {}; ///< Header where mapping is not available
+    std::vector<ScoreRecord> _memoryRecords; ///< Records where mapping is not available
+};
+
+#endif // STELLARFORGE_SCORELOG_HPP
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LinkConditioner.cpp
+*/
+
+#include "LinkConditioner.hpp"
+#include <algorithm>
+
+LinkConditioner::LinkConditioner(const UdpSocket &socket, const float lossRate,
+    const std::chrono::milliseconds latency, const std::chrono::milliseconds jitter, const std::uint32_t seed)
+    : _socket(socket), _lossRate(lossRate), _latency(latency), _jitter(jitter), _random(seed)
+{
+}
+
+void LinkConditioner::send(const std::uint8_t *data, const std::size_t size)
+{
+    _sent++;
+    if (_lossRate > 0 && std::uniform_real_distribution<float>(0, 1)(_random) < _lossRate) {
+        _dropped++;
+        return;
+    }
+    if (_latency.count() == 0 && _jitter.count() == 0) {
+        _socket.send(data, size);
+        return;
+    }
+    auto delay = _latency;
+    if (_jitter.count() > 0) {
+        delay += std::chrono::milliseconds(std::uniform_int_distribution<std::chrono::milliseconds::rep>(0, _jitter.count())(_random));
+    }
+    Pending pending {Clock::now() + delay, std::vector<std::uint8_t>(data, data + size)};
+    const auto position = std::upper_bound(_pending.begin(), _pending.end(), pending.due,
+        [](const Clock::time_point due, const Pending &other) { return due < other.due; });
+    _pending.insert(position, std::move(pending));
+}
+
+void LinkConditioner::flush()
+{
+    const auto now = Clock::now();
+    while (!_pending.empty() && _pending.front().due <= now) {
+        _socket.send(_pending.front().bytes.data(), _pending.front().bytes.size());
+        _pending.pop_front();
+    }
+}
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LinkConditioner.hpp
+*/
+
+#ifndef STELLARFORGE_LINKCONDITIONER_HPP
+#define STELLARFORGE_LINKCONDITIONER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+#include "UdpSocket.hpp"
+
+/**
+ * @class LinkConditioner
+ * @brief Injects packet loss, latency and jitter in front of a UdpSocket.
+ *
+ * Outgoing datagrams are dropped or held back before reaching the socket,
+ * which makes a loopback link behave like a bad network.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class LinkConditioner {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructor for the LinkConditioner class.
+     * @param socket Socket the surviving datagrams are sent through.
+     * @param lossRate Probability in [0, 1] for a datagram to be dropped.
+     * @param latency One-way delay added to every datagram.
+     * @param jitter Maximum random delay added on top of the latency.
+     * @param seed Seed of the loss and jitter draws.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    LinkConditioner(const UdpSocket &socket, float lossRate, std::chrono::milliseconds latency,
+        std::chrono::milliseconds jitter, std::uint32_t seed);
+
+    /**
+     * @brief Drops or schedules a datagram.
+     * @param data Bytes to send.
+     * @param size Number of bytes to send.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void send(const std::uint8_t *data, std::size_t size);
+
+    /**
+     * @brief Sends every scheduled datagram whose delay has elapsed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void flush();
+
+    /**
+     * @brief Gets the number of datagrams handed to send.
+     * @return The number of datagrams handed to send.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getSentCount() const { return _sent; }
+
+    /**
+     * @brief Gets the number of datagrams dropped on purpose.
+     * @return The number of dropped datagrams.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getDroppedCount() const { return _dropped; }
+
+private:
+    /**
+     * @struct Pending
+     * @brief A datagram waiting for its delay to elapse.
+     */
+    struct Pending {
+        Clock::time_point due; ///< Time the datagram is sent at
+        std::vector<std::uint8_t> bytes; ///< Content of the datagram
+    };
+
+    const UdpSocket &_socket; ///< Underlying socket
+    float _lossRate; ///< Probability for a datagram to be dropped
+    std::chrono::milliseconds _latency; ///< One-way delay
+    std::chrono::milliseconds _jitter; ///< Maximum extra delay
+    std::mt19937 _random; ///< Loss and jitter draws
+    std::deque<Pending> _pending; ///< Datagrams held back
+    std::uint64_t _sent = 0; ///< Datagrams handed to send
+    std::uint64_t _dropped = 0; ///< Datagrams dropped
+};
+
+#endif // STELLARFORGE_LINKCONDITIONER_HPP
@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** UdpSocket.cpp
+*/
+
+#include "UdpSocket.hpp"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <unistd.h>
+
+UdpSocket::UdpSocket(const std::uint16_t localPort, const std::string &peerHost, const std::uint16_t peerPort)
+{
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0) {
+        throw std::runtime_error("UdpSocket: cannot open socket");
+    }
+    sockaddr_in local {};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(localPort);
+    if (bind(_fd, reinterpret_cast<sockaddr *>(&local), sizeof(local)) < 0) {
+        close(_fd);
+        throw std::runtime_error("UdpSocket: cannot bind port " + std::to_string(localPort));
+    }
+    if (fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL, 0) | O_NONBLOCK) < 0) {
+        close(_fd);
+        throw std::runtime_error("UdpSocket: cannot make the socket non-blocking");
+    }
+    _peer.sin_family = AF_INET;
+    _peer.sin_port = htons(peerPort);
+    if (inet_pton(AF_INET, peerHost.c_str(), &_peer.sin_addr) != 1) {
+        close(_fd);
+        throw std::runtime_error("UdpSocket: invalid peer address " + peerHost);
+    }
+}
+
+UdpSocket::~UdpSocket()
+{
+    close(_fd);
+}
+
+bool UdpSocket::send(const std::uint8_t *data, const std::size_t size) const
+{
+    return sendto(_fd, data, size, 0, reinterpret_cast<const sockaddr *>(&_peer), sizeof(_peer)) == static_cast<ssize_t>(size);
+}
+
+std::size_t UdpSocket::receive(std::uint8_t *buffer, const std::size_t capacity) const
+{
+    sockaddr_in from {};
+    while (true) {
+        socklen_t fromSize = sizeof(from);
+        const ssize_t size = recvfrom(_fd, buffer, capacity, 0, reinterpret_cast<sockaddr *>(&from), &fromSize);
+        if (size <= 0) {
+            return 0;
+        }
+        if (from.sin_addr.s_addr == _peer.sin_addr.s_addr && from.sin_port == _peer.sin_port) {
+            return static_cast<std::size_t>(size);
+        }
+    }
+}
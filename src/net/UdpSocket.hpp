@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** UdpSocket.hpp
+*/
+
+#ifndef STELLARFORGE_UDPSOCKET_HPP
+#define STELLARFORGE_UDPSOCKET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <netinet/in.h>
+
+/**
+ * @class UdpSocket
+ * @brief Non-blocking IPv4 UDP socket talking to a single peer.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class UdpSocket {
+public:
+    /**
+     * @brief Opens a socket bound to a local port.
+     * @param localPort Port to listen on.
+     * @param peerHost IPv4 address of the peer.
+     * @param peerPort Port of the peer.
+     * @throws std::runtime_error if the socket cannot be opened or bound.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    UdpSocket(std::uint16_t localPort, const std::string &peerHost, std::uint16_t peerPort);
+
+    /**
+     * @brief Closes the socket.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket &) = delete;
+    UdpSocket &operator=(const UdpSocket &) = delete;
+
+    /**
+     * @brief Sends a datagram to the peer.
+     * @param data Bytes to send.
+     * @param size Number of bytes to send.
+     * @return True if the datagram was handed to the kernel.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool send(const std::uint8_t *data, std::size_t size) const;
+
+    /**
+     * @brief Reads one pending datagram from the peer, without blocking.
+     * @param buffer Destination buffer.
+     * @param capacity Size of the destination buffer.
+     * @return Number of bytes read, 0 if nothing is pending.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::size_t receive(std::uint8_t *buffer, std::size_t capacity) const;
+
+private:
+    int _fd = -1; ///< Socket descriptor
+    sockaddr_in _peer {}; ///< Address of the peer
+};
+
+#endif // STELLARFORGE_UDPSOCKET_HPP
@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ComponentManifest.cpp
+*/
+
+#include "ComponentManifest.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include "SharedLibrary.hpp"
+
+namespace {
+    constexpr const char *MANIFEST_HEADER = "flappy-components 1";
+
+    using ComponentNames = const char **(*)();
+
+    std::filesystem::path libraryPath(const std::string &directory, const std::string &library)
+    {
+        return std::filesystem::path(directory) / library;
+    }
+
+    // Reads the size and modification time, returns false if the library is gone.
+    bool stamp(const std::filesystem::path &path, std::uint64_t &size, std::int64_t &modified)
+    {
+        std::error_code error;
+        size = std::filesystem::file_size(path, error);
+        if (error) {
+            return false;
+        }
+        modified = static_cast<std::int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+        return !error;
+    }
+}
+
+ComponentManifest ComponentManifest::read(const std::string &directory)
+{
+    ComponentManifest manifest;
+    std::ifstream file(std::filesystem::path(directory) / FILE_NAME);
+    std::string line;
+    if (!file || !std::getline(file, line) || line != MANIFEST_HEADER) {
+        return manifest;
+    }
+    // One library per line: name, size, modification time, then its components, tab separated.
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        ManifestEntry entry;
+        std::string size;
+        std::string modified;
+        if (!std::getline(fields, entry.library, '\t') || !std::getline(fields, size, '\t') || !std::getline(fields, modified, '\t')) {
+            continue;
+        }
+        try {
+            entry.size = std::stoull(size);
+            entry.modified = std::stoll(modified);
+        } catch (const std::exception &) {
+            continue;
+        }
+        for (std::string component; std::getline(fields, component, '\t');) {
+            entry.components.push_back(component);
+        }
+        manifest.set(std::move(entry));
+    }
+    return manifest;
+}
+
+void ComponentManifest::write(const std::string &directory) const
+{
+    const std::filesystem::path path = std::filesystem::path(directory) / FILE_NAME;
+    // Written aside and renamed, so a game starting during a plugin build never reads half a manifest.
+    const std::filesystem::path temporary = path.string() + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        file << MANIFEST_HEADER << "\n";
+        for (const auto &entry : _entries) {
+            file << entry.library << "\t" << entry.size << "\t" << entry.modified;
+            for (const auto &component : entry.components) {
+                file << "\t" << component;
+            }
+            file << "\n";
+        }
+        if (!file) {
+            throw std::runtime_error("Cannot write " + temporary.string());
+        }
+    }
+    std::filesystem::rename(temporary, path);
+}
+
+std::vector<std::string> ComponentManifest::libraries(const std::string &directory)
+{
+    std::vector<std::string> names;
+    std::error_code error;
+    for (const auto &file : std::filesystem::directory_iterator(directory, error)) {
+        const std::string name = file.path().filename().string();
+        if (file.is_regular_file() && SharedLibrary::isLibrary(name)) {
+            names.push_back(name);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+ManifestEntry ComponentManifest::probe(const std::string &directory, const std::string &library)
+{
+    const std::filesystem::path path = libraryPath(directory, library);
+    ManifestEntry entry;
+    entry.library = library;
+    if (!stamp(path, entry.size, entry.modified)) {
+        throw std::runtime_error("Cannot stat " + path.string());
+    }
+    const SharedLibrary opened(path.string());
+    const auto names = opened.get<ComponentNames>("getComponentName");
+    if (names == nullptr) {
+        throw std::runtime_error(path.string() + " has no getComponentName");
+    }
+    for (const char **name = names(); name != nullptr && *name != nullptr; name++) {
+        entry.components.emplace_back(*name);
+    }
+    return entry;
+}
+
+bool ComponentManifest::isCurrent(const std::string &directory, const ManifestEntry &entry)
+{
+    std::uint64_t size = 0;
+    std::int64_t modified = 0;
+    return stamp(libraryPath(directory, entry.library), size, modified) && size == entry.size && modified == entry.modified;
+}
+
+const ManifestEntry *ComponentManifest::find(const std::string &library) const
+{
+    const auto found = std::lower_bound(_entries.begin(), _entries.end(), library,
+        [](const ManifestEntry &entry, const std::string &name) { return entry.library < name; });
+    return found != _entries.end() && found->library == library ? &*found : nullptr;
+}
+
+void ComponentManifest::set(ManifestEntry entry)
+{
+    const auto found = std::lower_bound(_entries.begin(), _entries.end(), entry.library,
+        [](const ManifestEntry &existing, const std::string &name) { return existing.library < name; });
+    if (found != _entries.end() && found->library == entry.library) {
+        *found = std::move(entry);
+    } else {
+        _entries.insert(found, std::move(entry));
+    }
+}
@@ -0,0 +1,130 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ComponentManifest.hpp
+*/
+
+#ifndef STELLARFORGE_COMPONENTMANIFEST_HPP
+#define STELLARFORGE_COMPONENTMANIFEST_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ManifestEntry
+ * @brief Components registered by one plugin library.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct ManifestEntry {
+    std::string library; ///< File name of the library, relative to the plugin directory
+    std::uint64_t size = 0; ///< Size of the library when it was listed
+    std::int64_t modified = 0; ///< Modification time of the library when it was listed
+    std::vector<std::string> components; ///< Names returned by its getComponentName
+};
+
+/**
+ * @class ComponentManifest
+ * @brief Cached list of the component names of every plugin library of a directory.
+ *
+ * The manifest lets the game know which library registers a component
+ * without opening the library. It is written next to the libraries by
+ * flappy-plugin-manifest after each plugin build, and an entry whose
+ * library changed size or modification time since is considered stale.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class ComponentManifest {
+public:
+    static constexpr const char *FILE_NAME = "components.manifest"; ///< Manifest file in the plugin directory
+
+    /**
+     * @brief Reads the manifest of a plugin directory.
+     * @param directory Plugin directory.
+     * @return The entries, empty if there is no manifest or it has another version.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static ComponentManifest read(const std::string &directory);
+
+    /**
+     * @brief Writes the manifest of a plugin directory.
+     * @param directory Plugin directory.
+     * @throw std::runtime_error If the file cannot be written.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void write(const std::string &directory) const;
+
+    /**
+     * @brief Lists the plugin libraries of a directory.
+     * @param directory Plugin directory.
+     * @return File names of the shared libraries, sorted.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static std::vector<std::string> libraries(const std::string &directory);
+
+    /**
+     * @brief Opens a library to list its components, then closes it.
+     * @param directory Plugin directory.
+     * @param library File name of the library.
+     * @return The entry of the library.
+     * @throw std::runtime_error If the library cannot be opened or has no getComponentName.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static ManifestEntry probe(const std::string &directory, const std::string &library);
+
+    /**
+     * @brief Checks an entry still describes its library.
+     * @param directory Plugin directory.
+     * @param entry Entry to check.
+     * @return False if the library is gone or changed since it was listed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static bool isCurrent(const std::string &directory, const ManifestEntry &entry);
+
+    /**
+     * @brief Finds the entry of a library.
+     * @param library File name of the library.
+     * @return The entry, or nullptr if the library is not listed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const ManifestEntry *find(const std::string &library) const;
+
+    /**
+     * @brief Adds an entry, replacing the one of the same library.
+     * @param entry Entry to store.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void set(ManifestEntry entry);
+
+    /**
+     * @brief Gets every entry.
+     * @return The entries, sorted by library.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const std::vector<ManifestEntry> &getEntries() const { return _entries; }
+
+private:
+    std::vector<ManifestEntry> _entries; ///< Entries sorted by library
+};
+
+#endif // STELLARFORGE_COMPONENTMANIFEST_HPP
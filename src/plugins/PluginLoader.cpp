@@ -0,0 +1,95 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** PluginLoader.cpp
+*/
+
+#include "PluginLoader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    using RegisterComponents = void (*)(ComponentFactory *);
+
+    bool usesAny(const ManifestEntry &entry, const std::vector<std::string> &components)
+    {
+        return std::any_of(entry.components.begin(), entry.components.end(), [&components](const std::string &name) {
+            return std::find(components.begin(), components.end(), name) != components.end();
+        });
+    }
+}
+
+PluginLoader &PluginLoader::getInstance()
+{
+    // Never destroyed: the engine keeps components and factory entries pointing into the libraries until exit.
+    static auto *instance = new PluginLoader(DEFAULT_DIRECTORY);
+    return *instance;
+}
+
+PluginLoader::PluginLoader(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+void PluginLoader::refreshManifest()
+{
+    _refreshed = true;
+    _manifest = ComponentManifest::read(_directory);
+    const std::vector<std::string> libraries = ComponentManifest::libraries(_directory);
+    _stats.available = static_cast<std::uint32_t>(libraries.size());
+    ComponentManifest current;
+    bool changed = libraries.size() != _manifest.getEntries().size();
+    for (const auto &library : libraries) {
+        const ManifestEntry *entry = _manifest.find(library);
+        if (entry != nullptr && ComponentManifest::isCurrent(_directory, *entry)) {
+            current.set(*entry);
+            continue;
+        }
+        changed = true;
+        try {
+            current.set(ComponentManifest::probe(_directory, library));
+            _stats.probed++;
+        } catch (const std::exception &e) {
+            std::cerr << "Skipping plugin " << library << ": " << e.what() << std::endl;
+        }
+    }
+    _manifest = std::move(current);
+    if (!changed) {
+        return;
+    }
+    try {
+        _manifest.write(_directory);
+    } catch (const std::exception &e) {
+        std::cerr << "Could not update the component manifest: " << e.what() << std::endl;
+    }
+}
+
+std::size_t PluginLoader::load(const std::vector<std::string> &components, ComponentFactory *factory)
+{
+    const auto started = std::chrono::steady_clock::now();
+    if (!_refreshed) {
+        refreshManifest();
+    }
+    std::size_t opened = 0;
+    for (const auto &entry : _manifest.getEntries()) {
+        if (_opened.count(entry.library) != 0 || !usesAny(entry, components)) {
+            continue;
+        }
+        auto library = std::make_unique<SharedLibrary>((std::filesystem::path(_directory) / entry.library).string());
+        const auto registerComponents = library->get<RegisterComponents>("registerComponents");
+        if (registerComponents == nullptr) {
+            throw std::runtime_error(entry.library + " has no registerComponents");
+        }
+        registerComponents(factory);
+        _opened.emplace(entry.library, std::move(library));
+        opened++;
+    }
+    _stats.opened += static_cast<std::uint32_t>(opened);
+    _stats.milliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+    return opened;
+}
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** PluginLoader.hpp
+*/
+
+#ifndef STELLARFORGE_PLUGINLOADER_HPP
+#define STELLARFORGE_PLUGINLOADER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ComponentManifest.hpp"
+#include "SharedLibrary.hpp"
+
+class ComponentFactory;
+
+/**
+ * @struct PluginStats
+ * @brief What the plugin loads cost so far.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct PluginStats {
+    std::uint32_t available = 0; ///< Libraries in the plugin directory
+    std::uint32_t opened = 0; ///< Libraries opened because a scene uses their components
+    std::uint32_t probed = 0; ///< Libraries opened only to refresh their manifest entry
+    double milliseconds = 0; ///< Time spent reading the manifest and opening libraries
+};
+
+/**
+ * @class PluginLoader
+ * @brief Opens the component plugins a scene uses, and only those.
+ *
+ * The engine DynamicComponentLoader opens every library of the plugin
+ * directory at startup. This loader reads the ComponentManifest instead and
+ * opens a library the first time a scene names one of its components.
+ * Libraries missing from the manifest or changed since it was written are
+ * probed once and the manifest is rewritten, so a stale manifest costs one
+ * slow start rather than wrong components.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class PluginLoader {
+public:
+    static constexpr const char *DEFAULT_DIRECTORY = "assets/components"; ///< Plugin directory of the game
+
+    /**
+     * @brief Gets the loader of the game plugin directory.
+     * @return The PluginLoader instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static PluginLoader &getInstance();
+
+    /**
+     * @brief Constructor for the PluginLoader class.
+     * @param directory Plugin directory.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit PluginLoader(std::string directory);
+
+    /**
+     * @brief Opens the libraries registering the given components and not opened yet.
+     * @param components Component names a scene uses.
+     * @param factory Factory the libraries register their components into.
+     * @return Number of libraries opened by this call.
+     * @throw std::runtime_error If a needed library cannot be opened or registered.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::size_t load(const std::vector<std::string> &components, ComponentFactory *factory);
+
+    /**
+     * @brief Gets what the loads cost so far.
+     * @return The plugin statistics.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const PluginStats &getStats() const { return _stats; }
+
+private:
+    /**
+     * @brief Probes the libraries the manifest does not describe and rewrites it if needed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void refreshManifest();
+
+    std::string _directory; ///< Plugin directory
+    ComponentManifest _manifest; ///< Components of every library
+    bool _refreshed = false; ///< The manifest was checked against the directory
+    std::unordered_map<std::string, std::unique_ptr<SharedLibrary>> _opened; ///< Opened libraries by file name
+    PluginStats _stats; ///< Load statistics
+};
+
+#endif // STELLARFORGE_PLUGINLOADER_HPP
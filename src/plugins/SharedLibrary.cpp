@@ -0,0 +1,64 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SharedLibrary.cpp
+*/
+
+#include "SharedLibrary.hpp"
+#include <filesystem>
+#include <stdexcept>
+#ifdef _WIN32
+ #include <windows.h>
+#else
+ #include <dlfcn.h>
+#endif // _WIN32
+
+#ifdef _WIN32
+
+SharedLibrary::SharedLibrary(const std::string &path)
+    : _handle(LoadLibraryA(path.c_str()))
+{
+    if (_handle == nullptr) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+}
+
+SharedLibrary::~SharedLibrary()
+{
+    FreeLibrary(static_cast<HMODULE>(_handle));
+}
+
+void *SharedLibrary::symbol(const char *name) const
+{
+    return reinterpret_cast<void *>(GetProcAddress(static_cast<HMODULE>(_handle), name));
+}
+
+#else
+
+SharedLibrary::SharedLibrary(const std::string &path)
+    : _handle(dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL))
+{
+    if (_handle == nullptr) {
+        const char *error = dlerror();
+        throw std::runtime_error("Cannot open " + path + (error != nullptr ? std::string(": ") + error : std::string()));
+    }
+}
+
+SharedLibrary::~SharedLibrary()
+{
+    dlclose(_handle);
+}
+
+void *SharedLibrary::symbol(const char *name) const
+{
+    return dlsym(_handle, name);
+}
+
+#endif // _WIN32
+
+bool SharedLibrary::isLibrary(const std::string &fileName)
+{
+    const std::string extension = std::filesystem::path(fileName).extension().string();
+    return extension == ".so" || extension == ".dylib" || extension == ".dll";
+}
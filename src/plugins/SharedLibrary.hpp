@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SharedLibrary.hpp
+*/
+
+#ifndef STELLARFORGE_SHAREDLIBRARY_HPP
+#define STELLARFORGE_SHAREDLIBRARY_HPP
+
+#include <string>
+
+/**
+ * @class SharedLibrary
+ * @brief Shared library opened for the lifetime of the object.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SharedLibrary {
+public:
+    /**
+     * @brief Opens a library.
+     * @param path Path of the library.
+     * @throw std::runtime_error If the library cannot be opened.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit SharedLibrary(const std::string &path);
+
+    /**
+     * @brief Closes the library.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~SharedLibrary();
+
+    SharedLibrary(const SharedLibrary &) = delete;
+    SharedLibrary &operator=(const SharedLibrary &) = delete;
+
+    /**
+     * @brief Looks up an exported function.
+     * @tparam Function Function pointer type.
+     * @param name Exported name.
+     * @return The function, or nullptr if the library does not export it.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    template <typename Function>
+    Function get(const char *name) const
+    {
+        return reinterpret_cast<Function>(symbol(name));
+    }
+
+    /**
+     * @brief Tells whether a file name looks like a shared library of this platform.
+     * @param fileName File name to check.
+     * @return True for .so, .dylib or .dll files.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static bool isLibrary(const std::string &fileName);
+
+private:
+    /**
+     * @brief Looks up an exported symbol.
+     * @param name Exported name.
+     * @return Address of the symbol, or nullptr.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] void *symbol(const char *name) const;
+
+    void *_handle = nullptr; ///< Platform handle of the library
+};
+
+#endif // STELLARFORGE_SHAREDLIBRARY_HPP
@@ -0,0 +1,44 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Autopilot.cpp
+*/
+
+#include "Autopilot.hpp"
+#include "src/sim/GameRules.hpp"
+#include <algorithm>
+
+namespace {
+    // Draws are 32-bit, so 2^32 skips every tick. Computed in double: a float rounds 2^32 - 1 up to 2^32.
+    std::uint64_t skipThreshold(const float sloppiness)
+    {
+        const double share = sloppiness > 0 ? std::min(static_cast<double>(sloppiness), 1.0) : 0.0;
+        return static_cast<std::uint64_t>(share * 4294967296.0);
+    }
+}
+
+Autopilot::Autopilot(const std::uint32_t seed, const float sloppiness)
+    : _random(seed), _threshold(skipThreshold(sloppiness))
+{
+}
+
+bool Autopilot::decide(const GameSnapshot &state)
+{
+    if (state.birdDead || _random.next() < _threshold) {
+        return false;
+    }
+    float target = GameRules::GROUND / 2 - GameRules::BIRD_HEIGHT / 2;
+    float nearest = 1e9f;
+    for (std::uint8_t i = 0; i < state.pipeCount; i++) {
+        const PipeSnapshot &pipe = state.pipes[i];
+        // Aims for the gap of the nearest pair the bird has not cleared yet.
+        const float right = pipe.x + GameRules::PIPE_WIDTH;
+        if (right < state.birdX || right >= nearest) {
+            continue;
+        }
+        nearest = right;
+        target = pipe.gapCentre - GameRules::BIRD_HEIGHT / 2;
+    }
+    return state.birdY > target && state.birdVelocityY > 0;
+}
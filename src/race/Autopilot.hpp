@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Autopilot.hpp
+*/
+
+#ifndef STELLARFORGE_AUTOPILOT_HPP
+#define STELLARFORGE_AUTOPILOT_HPP
+
+#include "src/state/GameSnapshot.hpp"
+#include "src/utils/Random.hpp"
+
+/**
+ * @class Autopilot
+ * @brief Scripted player aiming for the centre of the next gap.
+ *
+ * Drives headless races; a share of its decisions is randomly skipped so two
+ * autopilots with different seeds fly different paths.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class Autopilot {
+public:
+    /**
+     * @brief Constructor for the Autopilot class.
+     * @param seed Seed of the skipped decisions.
+     * @param sloppiness Probability in [0, 1] to ignore a tick, clamped to that range.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    Autopilot(std::uint32_t seed, float sloppiness);
+
+    /**
+     * @brief Decides whether to jump on this tick.
+     * @param state State of the bird being driven.
+     * @return True to jump.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool decide(const GameSnapshot &state);
+
+private:
+    Random _random; ///< Source of the skipped decisions
+    std::uint64_t _threshold; ///< Draws below this value skip the tick
+};
+
+#endif // STELLARFORGE_AUTOPILOT_HPP
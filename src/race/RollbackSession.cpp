@@ -0,0 +1,172 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** RollbackSession.cpp
+*/
+
+#include "RollbackSession.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "src/sim/Simulation.hpp"
+
+namespace {
+    constexpr std::uint16_t PACKET_MAGIC = 0x4246;
+    constexpr std::size_t PACKET_HEADER_SIZE = 2 + 4 + 1;
+    constexpr std::size_t PACKET_FOOTER_SIZE = 4 + 4 + 4;
+
+    template <typename T>
+    void put(std::uint8_t *&cursor, const T value)
+    {
+        std::memcpy(cursor, &value, sizeof(T));
+        cursor += sizeof(T);
+    }
+
+    template <typename T>
+    T get(const std::uint8_t *&cursor)
+    {
+        T value;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+    std::uint32_t raceChecksum(const RaceState &state)
+    {
+        return Simulation::checksum(state.players[0]) ^ (Simulation::checksum(state.players[1]) * 16777619u);
+    }
+}
+
+RollbackSession::RollbackSession(const int localPlayer, const std::uint32_t seed, const float dt)
+    : _localPlayer(localPlayer), _dt(dt)
+{
+    Simulation::reset(_current.players[0], seed);
+    Simulation::reset(_current.players[1], seed);
+}
+
+bool RollbackSession::canAdvance() const
+{
+    return _frame < _remoteConfirmed + MAX_PREDICTION;
+}
+
+void RollbackSession::advance(const bool jump)
+{
+    synchronize();
+    _localInputs[_frame % HISTORY] = jump ? 1 : 0;
+    simulate(_frame);
+    _frame++;
+    _stats.frames++;
+    recordChecksums();
+}
+
+void RollbackSession::synchronize()
+{
+    if (_rollbackFrom == UINT32_MAX) {
+        return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint32_t depth = _frame - _rollbackFrom;
+    _current = _states[_rollbackFrom % HISTORY];
+    for (std::uint32_t frame = _rollbackFrom; frame < _frame; frame++) {
+        simulate(frame);
+    }
+    _rollbackFrom = UINT32_MAX;
+    const auto elapsed = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    _stats.rollbacks++;
+    _stats.resimulatedFrames += depth;
+    _stats.maxRollbackDepth = std::max<std::uint64_t>(_stats.maxRollbackDepth, depth);
+    _stats.resimulationNanoseconds += elapsed;
+    _stats.maxResimulationNanoseconds = std::max(_stats.maxResimulationNanoseconds, elapsed);
+    recordChecksums();
+}
+
+std::uint8_t RollbackSession::remoteInput(const std::uint32_t frame) const
+{
+    if (frame < _remoteConfirmed) {
+        return _remoteInputs[frame % HISTORY];
+    }
+    if (_remoteConfirmed == 0) {
+        return 0;
+    }
+    return _remoteInputs[(_remoteConfirmed - 1) % HISTORY];
+}
+
+void RollbackSession::simulate(const std::uint32_t frame)
+{
+    const std::uint32_t index = frame % HISTORY;
+    const std::uint8_t remote = remoteInput(frame);
+    _states[index] = _current;
+    _usedRemoteInputs[index] = remote;
+    Simulation::step(_current.players[_localPlayer], _localInputs[index] != 0, _dt);
+    Simulation::step(_current.players[1 - _localPlayer], remote != 0, _dt);
+}
+
+void RollbackSession::recordChecksums()
+{
+    const std::uint32_t synced = std::min(_remoteConfirmed, _frame);
+    while (_checkedFrames < synced) {
+        _checkedFrames++;
+        const RaceState &state = _checkedFrames == _frame ? _current : _states[_checkedFrames % HISTORY];
+        _checksums[_checkedFrames % HISTORY] = raceChecksum(state);
+    }
+}
+
+std::size_t RollbackSession::writePacket(std::uint8_t *buffer) const
+{
+    const std::uint32_t oldest = _frame > MAX_INPUTS_PER_PACKET ? _frame - MAX_INPUTS_PER_PACKET : 0;
+    const std::uint32_t start = std::max(std::min(_peerAck, _frame), oldest);
+    std::uint8_t *cursor = buffer;
+    put(cursor, PACKET_MAGIC);
+    put(cursor, start);
+    put(cursor, static_cast<std::uint8_t>(_frame - start));
+    for (std::uint32_t frame = start; frame < _frame; frame++) {
+        put(cursor, _localInputs[frame % HISTORY]);
+    }
+    put(cursor, _remoteConfirmed);
+    put(cursor, _checkedFrames);
+    put(cursor, _checkedFrames > 0 ? _checksums[_checkedFrames % HISTORY] : 0u);
+    return static_cast<std::size_t>(cursor - buffer);
+}
+
+bool RollbackSession::readPacket(const std::uint8_t *data, const std::size_t size)
+{
+    if (size < PACKET_HEADER_SIZE + PACKET_FOOTER_SIZE) {
+        return false;
+    }
+    const std::uint8_t *cursor = data;
+    if (get<std::uint16_t>(cursor) != PACKET_MAGIC) {
+        return false;
+    }
+    const auto start = get<std::uint32_t>(cursor);
+    const auto count = get<std::uint8_t>(cursor);
+    if (size != PACKET_HEADER_SIZE + count + PACKET_FOOTER_SIZE) {
+        return false;
+    }
+    _stats.packetsReceived++;
+    for (std::uint32_t i = 0; i < count; i++) {
+        const std::uint32_t frame = start + i;
+        const auto input = get<std::uint8_t>(cursor);
+        if (frame != _remoteConfirmed) {
+            continue;
+        }
+        _remoteInputs[frame % HISTORY] = input;
+        if (frame < _frame && _usedRemoteInputs[frame % HISTORY] != input) {
+            _rollbackFrom = std::min(_rollbackFrom, frame);
+        }
+        _remoteConfirmed++;
+    }
+    _peerAck = std::max(_peerAck, get<std::uint32_t>(cursor));
+    const auto checkFrame = get<std::uint32_t>(cursor);
+    const auto checksum = get<std::uint32_t>(cursor);
+    if (checkFrame > _comparedFrame && checkFrame <= _checkedFrames
+        && _checkedFrames - checkFrame < HISTORY - MAX_PREDICTION) {
+        _comparedFrame = checkFrame;
+        _stats.checksumsCompared++;
+        if (_checksums[checkFrame % HISTORY] != checksum) {
+            _stats.desyncs++;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,207 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** RollbackSession.hpp
+*/
+
+#ifndef STELLARFORGE_ROLLBACKSESSION_HPP
+#define STELLARFORGE_ROLLBACKSESSION_HPP
+
+#include <array>
+#include <cstdint>
+#include "src/state/GameSnapshot.hpp"
+
+/**
+ * @struct RaceState
+ * @brief Play state of both racers, each running the same seeded course.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct RaceState {
+    GameSnapshot players[2]; ///< One full game per player
+};
+
+/**
+ * @struct RollbackStats
+ * @brief Counters reported at the end of a race.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct RollbackStats {
+    std::uint64_t frames = 0; ///< Frames simulated for the first time
+    std::uint64_t rollbacks = 0; ///< Mispredictions that forced a rollback
+    std::uint64_t resimulatedFrames = 0; ///< Frames simulated again after a rollback
+    std::uint64_t maxRollbackDepth = 0; ///< Deepest rollback, in frames
+    std::uint64_t resimulationNanoseconds = 0; ///< Total time spent resimulating
+    std::uint64_t maxResimulationNanoseconds = 0; ///< Slowest single rollback
+    std::uint64_t predictionStalls = 0; ///< Ticks skipped because the prediction window was full
+    std::uint64_t packetsReceived = 0; ///< Valid packets read from the peer
+    std::uint64_t checksumsCompared = 0; ///< Confirmed frames cross-checked with the peer
+    std::uint64_t desyncs = 0; ///< Confirmed frames whose checksum differs from the peer's
+};
+
+/**
+ * @class RollbackSession
+ * @brief Input-only rollback netcode for a two-player race.
+ *
+ * Each peer simulates both birds. Remote inputs that have not arrived yet are
+ * predicted by repeating the last confirmed one; when the real input differs,
+ * the race is restored to the mispredicted frame and resimulated up to the
+ * present. Only inputs (and a checksum of confirmed frames) go on the wire.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class RollbackSession {
+public:
+    static constexpr std::uint32_t HISTORY = 128; ///< Frames of inputs and states kept
+    static constexpr std::uint32_t MAX_PREDICTION = 12; ///< Frames the local side may run ahead of the confirmed remote inputs
+    static constexpr std::uint32_t MAX_INPUTS_PER_PACKET = 64; ///< Unacknowledged inputs resent in each packet
+    static constexpr std::size_t MAX_PACKET_SIZE = 32 + MAX_INPUTS_PER_PACKET; ///< Largest packet writePacket produces
+
+    /**
+     * @brief Constructor for the RollbackSession class.
+     * @param localPlayer Index (0 or 1) of the player controlled by this process.
+     * @param seed Seed of the pipe course, must be the same on both peers.
+     * @param dt Duration of a frame in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    RollbackSession(int localPlayer, std::uint32_t seed, float dt);
+
+    /**
+     * @brief Tells whether the next frame can be simulated without exceeding the prediction window.
+     * @return True if advance may be called.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] bool canAdvance() const;
+
+    /**
+     * @brief Records the local input of the next frame and simulates it.
+     * @param jump Local jump input.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void advance(bool jump);
+
+    /**
+     * @brief Counts a tick skipped because canAdvance returned false.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void stall() { _stats.predictionStalls++; }
+
+    /**
+     * @brief Rolls back and resimulates if a received input contradicts a prediction.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void synchronize();
+
+    /**
+     * @brief Writes the packet for the peer: unacknowledged local inputs, ack and checksum.
+     * @param buffer Destination buffer, at least MAX_PACKET_SIZE bytes.
+     * @return Number of bytes written.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::size_t writePacket(std::uint8_t *buffer) const;
+
+    /**
+     * @brief Reads a packet from the peer.
+     * @param data Received bytes.
+     * @param size Number of received bytes.
+     * @return False if the packet is malformed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool readPacket(const std::uint8_t *data, std::size_t size);
+
+    /**
+     * @brief Gets the next frame to simulate.
+     * @return The current frame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getFrame() const { return _frame; }
+
+    /**
+     * @brief Gets the number of remote inputs received so far.
+     * @return The number of confirmed remote frames.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getConfirmedFrames() const { return _remoteConfirmed; }
+
+    /**
+     * @brief Tells whether the peer has been heard from.
+     * @return True once a valid packet was read.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] bool isConnected() const { return _stats.packetsReceived > 0; }
+
+    /**
+     * @brief Gets the current race state, possibly built on predicted inputs.
+     * @return The current race state.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const RaceState &getState() const { return _current; }
+
+    /**
+     * @brief Gets the local player's index.
+     * @return The local player's index.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] int getLocalPlayer() const { return _localPlayer; }
+
+    /**
+     * @brief Gets the session counters.
+     * @return The session counters.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const RollbackStats &getStats() const { return _stats; }
+
+private:
+    [[nodiscard]] std::uint8_t remoteInput(std::uint32_t frame) const;
+    void simulate(std::uint32_t frame);
+    void recordChecksums();
+
+    int _localPlayer; ///< Index of the local player
+    float _dt; ///< Duration of a frame
+    std::uint32_t _frame = 0; ///< Next frame to simulate
+    std::uint32_t _remoteConfirmed = 0; ///< Remote inputs received, frames [0, _remoteConfirmed) are known
+    std::uint32_t _peerAck = 0; ///< Local inputs the peer has received
+    std::uint32_t _rollbackFrom = UINT32_MAX; ///< Oldest mispredicted frame, UINT32_MAX if none
+    std::uint32_t _checkedFrames = 0; ///< Confirmed frames whose checksum is recorded
+    std::uint32_t _comparedFrame = 0; ///< Last frame cross-checked with the peer
+    RaceState _current; ///< State at the start of _frame
+    std::array<RaceState, HISTORY> _states {}; ///< State at the start of each recent frame
+    std::array<std::uint8_t, HISTORY> _localInputs {}; ///< Local inputs of recent frames
+    std::array<std::uint8_t, HISTORY> _remoteInputs {}; ///< Confirmed remote inputs of recent frames
+    std::array<std::uint8_t, HISTORY> _usedRemoteInputs {}; ///< Remote inputs the simulation actually used
+    std::array<std::uint32_t, HISTORY> _checksums {}; ///< Checksum of the state at the start of recent confirmed frames
+    RollbackStats _stats; ///< Session counters
+};
+
+#endif // STELLARFORGE_ROLLBACKSESSION_HPP
@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** BitmapFont.cpp
+*/
+
+#include "BitmapFont.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace {
+    constexpr char CHARACTERS[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ!.:-? ";
+
+    // One row per byte, the leftmost pixel in bit 4.
+    constexpr std::uint8_t GLYPHS[][BitmapFont::GLYPH_HEIGHT] = {
+        {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}, {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},
+        {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}, {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},
+        {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}, {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},
+        {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}, {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},
+        {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},
+        {0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11}, {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},
+        {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}, {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},
+        {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}, {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},
+        {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}, {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
+        {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}, {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},
+        {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}, {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},
+        {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}, {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},
+        {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},
+        {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}, {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},
+        {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}, {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
+        {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04},
+        {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}, {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},
+        {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04}, {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},
+        {0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},
+        {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}, {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},
+        {0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    };
+    static_assert(sizeof(GLYPHS) / sizeof(GLYPHS[0]) == sizeof(CHARACTERS) - 1, "One glyph per character");
+
+    const std::uint8_t *glyphOf(const char character)
+    {
+        const char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+        const char *found = upper != '\0' ? std::strchr(CHARACTERS, upper) : nullptr;
+        return GLYPHS[found != nullptr ? found - CHARACTERS : std::strchr(CHARACTERS, '?') - CHARACTERS];
+    }
+}
+
+int BitmapFont::scaleFor(const unsigned characterSize)
+{
+    // Capitals take about 70% of the character size.
+    return std::max(1, static_cast<int>(characterSize * 7 / 10 / GLYPH_HEIGHT));
+}
+
+int BitmapFont::measure(const std::string &text, const int scale)
+{
+    if (text.empty()) {
+        return 0;
+    }
+    return (static_cast<int>(text.size()) * ADVANCE - (ADVANCE - GLYPH_WIDTH)) * scale;
+}
+
+void BitmapFont::draw(Framebuffer &target, const std::string &text, const int x, const int y, const int scale, const std::uint32_t rgba)
+{
+    int left = x;
+    for (const char character : text) {
+        const std::uint8_t *glyph = glyphOf(character);
+        for (int row = 0; row < GLYPH_HEIGHT; row++) {
+            for (int column = 0; column < GLYPH_WIDTH; column++) {
+                if ((glyph[row] >> (GLYPH_WIDTH - 1 - column) & 1) != 0) {
+                    target.fill(left + column * scale, y + row * scale, scale, scale, rgba);
+                }
+            }
+        }
+        left += ADVANCE * scale;
+    }
+}
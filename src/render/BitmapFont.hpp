@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** BitmapFont.hpp
+*/
+
+#ifndef STELLARFORGE_BITMAPFONT_HPP
+#define STELLARFORGE_BITMAPFONT_HPP
+
+#include <cstdint>
+#include <string>
+#include "Framebuffer.hpp"
+
+/**
+ * @namespace BitmapFont
+ * @brief Built-in 5x7 font used to draw UIText without a font rasterizer.
+ *
+ * Covers digits, letters (drawn in capitals) and a little punctuation, which
+ * is everything the score text shows. Other characters are drawn as '?'.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+namespace BitmapFont {
+    constexpr int GLYPH_WIDTH = 5; ///< Glyph width in font pixels
+    constexpr int GLYPH_HEIGHT = 7; ///< Glyph height in font pixels
+    constexpr int ADVANCE = 6; ///< Distance between two glyphs in font pixels
+
+    /**
+     * @brief Gets the font pixel size matching a UIText character size.
+     * @param characterSize UIText size in pixels.
+     * @return Screen pixels per font pixel, at least 1.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    int scaleFor(unsigned characterSize);
+
+    /**
+     * @brief Measures a line of text.
+     * @param text Text to measure.
+     * @param scale Screen pixels per font pixel.
+     * @return Width of the text in screen pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    int measure(const std::string &text, int scale);
+
+    /**
+     * @brief Draws a line of text.
+     * @param target Framebuffer to draw into.
+     * @param text Text to draw.
+     * @param x Left edge of the text.
+     * @param y Top edge of the text.
+     * @param scale Screen pixels per font pixel.
+     * @param rgba Colour as R, G, B, A bytes in memory order.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void draw(Framebuffer &target, const std::string &text, int x, int y, int scale, std::uint32_t rgba);
+}
+
+#endif // STELLARFORGE_BITMAPFONT_HPP
@@ -0,0 +1,140 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Framebuffer.cpp
+*/
+
+#include "Framebuffer.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAPPY_FRAMEBUFFER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+    constexpr std::uint32_t ALPHA_MASK = 0xFF000000u; // A is the last byte in memory, the top byte of a little-endian word
+
+    std::uint32_t load(const std::uint8_t *pixel)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, pixel, sizeof(value));
+        return value;
+    }
+
+    std::uint32_t blendPixel(const std::uint32_t source, const std::uint32_t target)
+    {
+        const std::uint32_t alpha = source >> 24;
+        if (alpha == 255) {
+            return source;
+        }
+        if (alpha == 0) {
+            return target;
+        }
+        std::uint32_t out = ALPHA_MASK;
+        for (int shift = 0; shift < 24; shift += 8) {
+            const std::uint32_t mixed = ((source >> shift) & 0xFF) * alpha + ((target >> shift) & 0xFF) * (255 - alpha) + 128;
+            out |= (((mixed + (mixed >> 8)) >> 8) & 0xFF) << shift;
+        }
+        return out;
+    }
+
+#ifdef FLAPPY_FRAMEBUFFER_SSE2
+    // Blends two pixels widened to 16-bit lanes, dividing by 255 exactly with the add-shift trick.
+    __m128i blendHalf(const __m128i source, const __m128i target)
+    {
+        __m128i alpha = _mm_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3));
+        alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+        __m128i mixed = _mm_add_epi16(_mm_mullo_epi16(source, alpha), _mm_mullo_epi16(target, inverse));
+        mixed = _mm_add_epi16(mixed, _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(mixed, _mm_srli_epi16(mixed, 8)), 8);
+    }
+
+    __m128i blendQuad(const __m128i source, const __m128i target)
+    {
+        const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(ALPHA_MASK));
+        const __m128i alpha = _mm_and_si128(source, alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xFFFF) {
+            return source;
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, _mm_setzero_si128())) == 0xFFFF) {
+            return target;
+        }
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i low = blendHalf(_mm_unpacklo_epi8(source, zero), _mm_unpacklo_epi8(target, zero));
+        const __m128i high = blendHalf(_mm_unpackhi_epi8(source, zero), _mm_unpackhi_epi8(target, zero));
+        return _mm_or_si128(_mm_packus_epi16(low, high), alphaMask);
+    }
+#endif
+
+    // Blends count pixels, reading the source backwards when reversed.
+    void blendRow(std::uint32_t *target, const std::uint8_t *source, const int count, const bool reversed)
+    {
+        int i = 0;
+#ifdef FLAPPY_FRAMEBUFFER_SSE2
+        for (; i + 4 <= count; i += 4) {
+            __m128i pixels;
+            if (reversed) {
+                pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source - (i + 3) * 4));
+                pixels = _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+            } else {
+                pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4));
+            }
+            auto *out = reinterpret_cast<__m128i *>(target + i);
+            _mm_storeu_si128(out, blendQuad(pixels, _mm_loadu_si128(out)));
+        }
+#endif
+        for (; i < count; i++) {
+            target[i] = blendPixel(load(reversed ? source - i * 4 : source + i * 4), target[i]);
+        }
+    }
+}
+
+Framebuffer::Framebuffer(const unsigned width, const unsigned height)
+    : _width(width), _height(height), _pixels(static_cast<std::size_t>(width) * height, 0)
+{
+}
+
+void Framebuffer::clear(const std::uint32_t rgba)
+{
+    std::fill(_pixels.begin(), _pixels.end(), rgba);
+}
+
+void Framebuffer::fill(const int x, const int y, const int width, const int height, const std::uint32_t rgba)
+{
+    const int left = std::max(x, 0);
+    const int right = std::min(x + width, static_cast<int>(_width));
+    const int top = std::max(y, 0);
+    const int bottom = std::min(y + height, static_cast<int>(_height));
+    for (int row = top; row < bottom && left < right; row++) {
+        std::uint32_t *line = _pixels.data() + static_cast<std::size_t>(row) * _width;
+        std::fill(line + left, line + right, rgba);
+    }
+}
+
+void Framebuffer::blit(const std::uint8_t *pixels, const unsigned width, const unsigned height, const int x, const int y, const bool rotated)
+{
+    const int left = std::max(x, 0);
+    const int right = std::min(x + static_cast<int>(width), static_cast<int>(_width));
+    const int top = std::max(y, 0);
+    const int bottom = std::min(y + static_cast<int>(height), static_cast<int>(_height));
+    if (pixels == nullptr || left >= right || top >= bottom) {
+        return;
+    }
+    const std::size_t stride = static_cast<std::size_t>(width) * 4;
+    for (int row = top; row < bottom; row++) {
+        // A half turn maps the image pixel (u, v) to (width - 1 - u, height - 1 - v).
+        const int v = rotated ? static_cast<int>(height) - 1 - (row - y) : row - y;
+        const int u = rotated ? static_cast<int>(width) - 1 - (left - x) : left - x;
+        const std::uint8_t *source = pixels + static_cast<std::size_t>(v) * stride + static_cast<std::size_t>(u) * 4;
+        blendRow(_pixels.data() + static_cast<std::size_t>(row) * _width + left, source, right - left, rotated);
+    }
+}
+
+void Framebuffer::blit(const Framebuffer &source, const int x, const int y)
+{
+    blit(source.data(), source._width, source._height, x, y);
+}
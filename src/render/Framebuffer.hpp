@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Framebuffer.hpp
+*/
+
+#ifndef STELLARFORGE_FRAMEBUFFER_HPP
+#define STELLARFORGE_FRAMEBUFFER_HPP
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class Framebuffer
+ * @brief In-memory RGBA8 image drawn by the software renderer.
+ *
+ * Pixels are stored as R, G, B, A bytes, row after row, so a frame can be
+ * handed to sf::Image or dumped as raw rgba video as is. Blits blend with
+ * straight alpha, four pixels at a time when SSE2 is available, and keep
+ * blended pixels opaque. A new framebuffer is fully transparent, so it can
+ * also hold a layer that is blitted onto another one.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class Framebuffer {
+public:
+    /**
+     * @brief Constructor for the Framebuffer class.
+     * @param width Width in pixels.
+     * @param height Height in pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    Framebuffer(unsigned width, unsigned height);
+
+    /**
+     * @brief Fills the whole frame with one colour.
+     * @param rgba Colour as R, G, B, A bytes in memory order.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void clear(std::uint32_t rgba);
+
+    /**
+     * @brief Fills a rectangle with one colour, clipped to the frame.
+     * @param x Left edge.
+     * @param y Top edge.
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @param rgba Colour as R, G, B, A bytes in memory order.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void fill(int x, int y, int width, int height, std::uint32_t rgba);
+
+    /**
+     * @brief Alpha blends an RGBA8 image into the frame, clipped to the frame.
+     * @param pixels Rows of RGBA8 pixels, top to bottom.
+     * @param width Width of the image.
+     * @param height Height of the image.
+     * @param x Left edge the image lands on.
+     * @param y Top edge the image lands on.
+     * @param rotated True to draw the image turned by 180 degrees.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void blit(const std::uint8_t *pixels, unsigned width, unsigned height, int x, int y, bool rotated = false);
+
+    /**
+     * @brief Alpha blends another framebuffer into this one.
+     * @param source Framebuffer to draw.
+     * @param x Left edge the source lands on.
+     * @param y Top edge the source lands on.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void blit(const Framebuffer &source, int x, int y);
+
+    /**
+     * @brief Gets the pixels.
+     * @return Rows of RGBA8 pixels, top to bottom.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const std::uint8_t *data() const { return reinterpret_cast<const std::uint8_t *>(_pixels.data()); }
+
+    /**
+     * @brief Gets the pixels for writing.
+     * @return Rows of RGBA8 pixels, top to bottom.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t *pixels() { return _pixels.data(); }
+
+    /**
+     * @brief Gets the size of the pixels in bytes.
+     * @return Width times height times 4.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return _pixels.size() * sizeof(std::uint32_t); }
+
+    /**
+     * @brief Gets the width.
+     * @return The width in pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] unsigned getWidth() const { return _width; }
+
+    /**
+     * @brief Gets the height.
+     * @return The height in pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] unsigned getHeight() const { return _height; }
+
+private:
+    unsigned _width; ///< Width in pixels
+    unsigned _height; ///< Height in pixels
+    std::vector<std::uint32_t> _pixels; ///< RGBA8 pixels
+};
+
+#endif // STELLARFORGE_FRAMEBUFFER_HPP
@@ -0,0 +1,46 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LayerCache.cpp
+*/
+
+#include "LayerCache.hpp"
+
+LayerCache::LayerCache(const std::size_t layers)
+    : _layers(layers)
+{
+}
+
+void LayerCache::beginFrame()
+{
+    _frame = LayerStats();
+    _frames++;
+}
+
+bool LayerCache::update(const std::size_t layer, const std::uint64_t fingerprint)
+{
+    Layer &entry = _layers.at(layer);
+    if (entry.valid && entry.fingerprint == fingerprint) {
+        _frame.reused++;
+        _total.reused++;
+        return false;
+    }
+    entry.fingerprint = fingerprint;
+    entry.valid = true;
+    _frame.redrawn++;
+    _total.redrawn++;
+    return true;
+}
+
+void LayerCache::invalidate(const std::size_t layer)
+{
+    _layers.at(layer).valid = false;
+}
+
+void LayerCache::invalidateAll()
+{
+    for (auto &layer : _layers) {
+        layer.valid = false;
+    }
+}
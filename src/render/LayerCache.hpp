@@ -0,0 +1,131 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LayerCache.hpp
+*/
+
+#ifndef STELLARFORGE_LAYERCACHE_HPP
+#define STELLARFORGE_LAYERCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct LayerStats
+ * @brief Number of layers redrawn and reused.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct LayerStats {
+    std::uint64_t redrawn = 0; ///< Layers whose inputs changed
+    std::uint64_t reused = 0; ///< Layers presented from their cached surface
+};
+
+/**
+ * @class LayerCache
+ * @brief Dirty tracking for retained render layers.
+ *
+ * Each layer is identified by its index and described by a fingerprint of
+ * everything it is drawn from. The caller owns the cached surfaces and only
+ * redraws a layer when update reports that its fingerprint changed.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class LayerCache {
+public:
+    /**
+     * @brief Constructor for the LayerCache class.
+     * @param layers Number of layers, all starting dirty.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit LayerCache(std::size_t layers);
+
+    /**
+     * @brief Starts a frame and resets the per-frame counts.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void beginFrame();
+
+    /**
+     * @brief Submits the inputs of a layer for this frame.
+     * @param layer Index of the layer.
+     * @param fingerprint Hash of everything the layer is drawn from.
+     * @return True if the cached surface is stale and must be redrawn.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool update(std::size_t layer, std::uint64_t fingerprint);
+
+    /**
+     * @brief Forces a layer to be redrawn on its next update.
+     * @param layer Index of the layer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void invalidate(std::size_t layer);
+
+    /**
+     * @brief Forces every layer to be redrawn, e.g. after the target was cleared.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void invalidateAll();
+
+    /**
+     * @brief Gets the counts of the current frame.
+     * @return Layers redrawn and reused since beginFrame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const LayerStats &getFrameStats() const { return _frame; }
+
+    /**
+     * @brief Gets the counts since the cache was created.
+     * @return Layers redrawn and reused over every frame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const LayerStats &getTotalStats() const { return _total; }
+
+    /**
+     * @brief Gets the number of frames started.
+     * @return The number of beginFrame calls.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getFrames() const { return _frames; }
+
+private:
+    /**
+     * @struct Layer
+     * @brief Fingerprint of the cached surface of a layer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct Layer {
+        std::uint64_t fingerprint = 0; ///< Inputs the surface was drawn from
+        bool valid = false; ///< The surface was drawn at least once since the last invalidation
+    };
+
+    std::vector<Layer> _layers; ///< Tracked layers
+    LayerStats _frame; ///< Counts of the current frame
+    LayerStats _total; ///< Counts of every frame
+    std::uint64_t _frames = 0; ///< Frames started
+};
+
+#endif // STELLARFORGE_LAYERCACHE_HPP
@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SoftwareRenderer.cpp
+*/
+
+#include "SoftwareRenderer.hpp"
+#include <cmath>
+#include "BitmapFont.hpp"
+#include "src/sim/GameRules.hpp"
+#include "src/utils/Hash.hpp"
+
+namespace {
+    constexpr std::uint32_t SKY = 0xFFE0C070u; // Stand-ins for missing textures, R in the low byte
+    constexpr std::uint32_t PIPE_GREEN = 0xFF30B040u;
+    constexpr std::uint32_t BIRD_YELLOW = 0xFF20D0F0u;
+    constexpr std::uint32_t TEXT_WHITE = 0xFFFFFFFFu;
+
+    int pixel(const float position)
+    {
+        return static_cast<int>(std::lround(position));
+    }
+}
+
+SoftwareRenderer::SoftwareRenderer(SceneTextures textures)
+    : _textures(std::move(textures)),
+    _hud(WIDTH, static_cast<unsigned>(BitmapFont::GLYPH_HEIGHT * BitmapFont::scaleFor(SCORE_SIZE)))
+{
+    _text.reserve(64);
+}
+
+const Framebuffer &SoftwareRenderer::render(const GameSnapshot &view)
+{
+    _layers.beginFrame();
+    drawBackground(view.backgroundX);
+    drawBird(view);
+    for (std::uint8_t i = 0; i < view.pipeCount; i++) {
+        drawPipe(view.pipes[i]);
+    }
+    drawHud(view);
+    _frame.blit(_hud, 0, SCORE_Y);
+    return _frame;
+}
+
+void SoftwareRenderer::drawBackground(const float x)
+{
+    const int scroll = pixel(x);
+    if (_layers.update(BACKGROUND, Hash::combine(Hash::FNV_OFFSET, scroll))) {
+        const DecodedTexture *texture = _textures.background.get();
+        if (texture == nullptr || texture->width == 0) {
+            _background.clear(SKY);
+        } else {
+            // The texture holds the field twice so the scroll wraps seamlessly, tile it anyway in case it is narrower.
+            for (int left = scroll; left < static_cast<int>(WIDTH); left += static_cast<int>(texture->width)) {
+                _background.blit(texture->pixels, texture->width, texture->height, left, 0);
+            }
+        }
+    }
+    // Same size, so the copy reuses the frame's pixels and never blends.
+    _frame = _background;
+}
+
+void SoftwareRenderer::drawBird(const GameSnapshot &view)
+{
+    if (const DecodedTexture *texture = _textures.bird.get(); texture != nullptr) {
+        _frame.blit(texture->pixels, texture->width, texture->height, pixel(view.birdX), pixel(view.birdY));
+        return;
+    }
+    _frame.fill(pixel(view.birdX), pixel(view.birdY), static_cast<int>(GameRules::BIRD_WIDTH), static_cast<int>(GameRules::BIRD_HEIGHT), BIRD_YELLOW);
+}
+
+void SoftwareRenderer::drawPipe(const PipeSnapshot &pipe)
+{
+    const DecodedTexture *texture = _textures.pipe.get();
+    const int width = texture != nullptr ? static_cast<int>(texture->width) : static_cast<int>(GameRules::PIPE_WIDTH);
+    const int height = texture != nullptr ? static_cast<int>(texture->height) : static_cast<int>(GameRules::PIPE_HEIGHT);
+    const int left = pixel(pipe.x);
+    // Both quads are anchored PIPE_HEIGHT away from the gap, the pipe texture has its cap at the bottom.
+    const int upperTop = pixel(pipe.gapTop() - GameRules::PIPE_HEIGHT);
+    const int lowerTop = pixel(pipe.gapBottom() + GameRules::PIPE_HEIGHT) - height;
+    if (texture == nullptr) {
+        _frame.fill(left, upperTop, width, height, PIPE_GREEN);
+        _frame.fill(left, lowerTop, width, height, PIPE_GREEN);
+        return;
+    }
+    _frame.blit(texture->pixels, texture->width, texture->height, left, upperTop);
+    // The lower pipe is the same quad turned by 180 degrees, so its cap faces the gap too.
+    _frame.blit(texture->pixels, texture->width, texture->height, left, lowerTop, true);
+}
+
+void SoftwareRenderer::drawHud(const GameSnapshot &view)
+{
+    if (!_layers.update(HUD, Hash::combine(Hash::combine(Hash::FNV_OFFSET, view.score), view.gameOver))) {
+        return;
+    }
+    // Same wording as the Score component.
+    _text.clear();
+    if (view.gameOver) {
+        _text += "Game Over! Your score is ";
+    }
+    _text += std::to_string(view.score);
+    const int scale = BitmapFont::scaleFor(SCORE_SIZE);
+    _hud.clear(0);
+    BitmapFont::draw(_hud, _text, (static_cast<int>(WIDTH) - BitmapFont::measure(_text, scale)) / 2, 0, scale, TEXT_WHITE);
+}
@@ -0,0 +1,100 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SoftwareRenderer.hpp
+*/
+
+#ifndef STELLARFORGE_SOFTWARERENDERER_HPP
+#define STELLARFORGE_SOFTWARERENDERER_HPP
+
+#include <memory>
+#include <string>
+#include "Framebuffer.hpp"
+#include "LayerCache.hpp"
+#include "src/assets/TextureCache.hpp"
+#include "src/state/GameSnapshot.hpp"
+
+/**
+ * @struct SceneTextures
+ * @brief Decoded sprite textures of the scene, any of them may be missing.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct SceneTextures {
+    std::shared_ptr<const DecodedTexture> background; ///< Scrolling background
+    std::shared_ptr<const DecodedTexture> pipe; ///< Pipe, turned by 180 degrees for the top pipe
+    std::shared_ptr<const DecodedTexture> bird; ///< Player
+};
+
+/**
+ * @class SoftwareRenderer
+ * @brief Draws the game on the CPU into an offscreen 1920x1080 framebuffer.
+ *
+ * Follows the scene layout: the background, then the bird, the pipes and the
+ * score text on top. A missing texture is drawn as a flat rectangle. The
+ * background only changes when it scrolls by a whole pixel and the score
+ * text only when a point is scored, so both are kept in their own layer and
+ * drawn again only when LayerCache reports a change. Once the game is over
+ * the background stops and a frame starts with a plain copy of it.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SoftwareRenderer {
+public:
+    static constexpr unsigned WIDTH = 1920; ///< Width of the frame
+    static constexpr unsigned HEIGHT = 1080; ///< Height of the frame
+    static constexpr unsigned SCORE_SIZE = 40; ///< Character size of the score UIText
+    static constexpr int SCORE_Y = 100; ///< Top of the score UIText
+
+    /**
+     * @brief Constructor for the SoftwareRenderer class.
+     * @param textures Sprite textures of the scene.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit SoftwareRenderer(SceneTextures textures);
+
+    /**
+     * @brief Draws one frame.
+     * @param view Play state to draw.
+     * @return The drawn frame, valid until the next call.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    const Framebuffer &render(const GameSnapshot &view);
+
+    /**
+     * @brief Gets the dirty tracking of the cached layers.
+     * @return The layer cache.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const LayerCache &getLayers() const { return _layers; }
+
+private:
+    enum Layer : std::size_t {
+        BACKGROUND, ///< Scrolling background
+        HUD, ///< Score text
+        LAYER_COUNT
+    };
+
+    void drawBackground(float x);
+    void drawBird(const GameSnapshot &view);
+    void drawPipe(const PipeSnapshot &pipe);
+    void drawHud(const GameSnapshot &view);
+
+    SceneTextures _textures; ///< Sprite textures
+    Framebuffer _frame {WIDTH, HEIGHT}; ///< Frame being drawn
+    Framebuffer _background {WIDTH, HEIGHT}; ///< Cached background at its last scroll position
+    Framebuffer _hud; ///< Cached score text strip
+    LayerCache _layers {LAYER_COUNT}; ///< Dirty tracking of the cached layers
+    std::string _text; ///< Reused score text buffer
+};
+
+#endif // STELLARFORGE_SOFTWARERENDERER_HPP
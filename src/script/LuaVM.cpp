@@ -0,0 +1,234 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LuaVM.cpp
+*/
+
+#include "LuaVM.hpp"
+#include "src/audit/AllocationAudit.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <lua.hpp>
+#include <stdexcept>
+
+namespace {
+    // Globals scripts may read; io, os, package, debug and the loaders stay out of reach.
+    constexpr const char *SAFE_GLOBALS[] = {
+        "assert", "error", "ipairs", "next", "pairs", "pcall", "print", "rawequal", "rawget", "rawlen",
+        "select", "tonumber", "tostring", "type", "xpcall", "math", "string", "table", "utf8",
+    };
+
+    // The chunk takes its environment as argument, on the first line so error lines stay right.
+    constexpr const char *ENVIRONMENT_PROLOGUE = "local _ENV = ...; ";
+
+    // Same as the lauxlib allocator, but growths count in the allocation audit, which only hooks operator new.
+    void *allocate(void *userData, void *memory, const std::size_t oldSize, const std::size_t newSize)
+    {
+        if (newSize == 0) {
+            std::free(memory);
+            return nullptr;
+        }
+#ifdef FLAPPY_ALLOCATION_AUDIT
+        if (memory == nullptr || newSize > oldSize) {
+            AllocationAudit::record(newSize);
+        }
+#endif // FLAPPY_ALLOCATION_AUDIT
+        return std::realloc(memory, newSize);
+    }
+
+    int refuseWrite(lua_State *state)
+    {
+        return luaL_error(state, "the standard libraries are read-only");
+    }
+
+    int libraryNext(lua_State *state)
+    {
+        lua_settop(state, 2);
+        return lua_next(state, 1) != 0 ? 2 : 0;
+    }
+
+    // Lets pairs walk the library behind a proxy.
+    int proxyPairs(lua_State *state)
+    {
+        lua_getmetatable(state, 1);
+        lua_pushcfunction(state, libraryNext);
+        lua_getfield(state, -2, "__index");
+        lua_pushnil(state);
+        return 3;
+    }
+
+    // Replaces the table on top of the stack with an empty proxy reading through to it and refusing writes.
+    void pushReadOnlyProxy(lua_State *state)
+    {
+        lua_newtable(state);
+        lua_newtable(state);
+        lua_pushvalue(state, -3);
+        lua_setfield(state, -2, "__index");
+        lua_pushcfunction(state, refuseWrite);
+        lua_setfield(state, -2, "__newindex");
+        lua_pushcfunction(state, proxyPairs);
+        lua_setfield(state, -2, "__pairs");
+        lua_pushboolean(state, 0);
+        lua_setfield(state, -2, "__metatable");
+        lua_setmetatable(state, -2);
+        lua_remove(state, -2);
+    }
+
+    std::string readFile(const std::string &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Cannot read " + path);
+        }
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+}
+
+LuaVM &LuaVM::getInstance()
+{
+    static LuaVM instance;
+    return instance;
+}
+
+LuaVM::LuaVM()
+    : _state(luaL_newstate())
+{
+    if (_state == nullptr) {
+        throw std::runtime_error("Cannot create the Lua state");
+    }
+    // luaL_newstate also allocates with realloc and free, so the state can switch allocator.
+    lua_setallocf(_state, allocate, nullptr);
+    luaL_requiref(_state, LUA_GNAME, luaopen_base, 1);
+    luaL_requiref(_state, LUA_MATHLIBNAME, luaopen_math, 1);
+    luaL_requiref(_state, LUA_STRLIBNAME, luaopen_string, 1);
+    luaL_requiref(_state, LUA_TABLIBNAME, luaopen_table, 1);
+    luaL_requiref(_state, LUA_UTF8LIBNAME, luaopen_utf8, 1);
+    lua_pop(_state, 5);
+
+    lua_newtable(_state);
+    lua_newtable(_state);
+    lua_pushglobaltable(_state);
+    for (const char *name : SAFE_GLOBALS) {
+        // Libraries are shared by every environment, so scripts only see them through read-only proxies.
+        if (lua_getfield(_state, -1, name) == LUA_TTABLE) {
+            pushReadOnlyProxy(_state);
+        }
+        lua_setfield(_state, -3, name);
+    }
+    lua_pop(_state, 1);
+    lua_setfield(_state, -2, "__index");
+    // Hides the metatable so a script cannot swap its sandbox.
+    lua_pushboolean(_state, 0);
+    lua_setfield(_state, -2, "__metatable");
+    _environmentMeta = luaL_ref(_state, LUA_REGISTRYINDEX);
+}
+
+LuaVM::~LuaVM()
+{
+    lua_close(_state);
+}
+
+int LuaVM::compile(const std::string &path)
+{
+    if (const auto found = _chunks.find(path); found != _chunks.end()) {
+        return found->second;
+    }
+    const std::string code = ENVIRONMENT_PROLOGUE + readFile(path);
+    const std::string name = "@" + path;
+    if (luaL_loadbufferx(_state, code.data(), code.size(), name.c_str(), "t") != LUA_OK) {
+        const std::string message = lua_tostring(_state, -1);
+        lua_pop(_state, 1);
+        throw std::runtime_error(message);
+    }
+    const int chunk = luaL_ref(_state, LUA_REGISTRYINDEX);
+    _chunks.emplace(path, chunk);
+    return chunk;
+}
+
+int LuaVM::createEnvironment()
+{
+    lua_newtable(_state);
+    lua_rawgeti(_state, LUA_REGISTRYINDEX, _environmentMeta);
+    lua_setmetatable(_state, -2);
+    _environments++;
+    return luaL_ref(_state, LUA_REGISTRYINDEX);
+}
+
+void LuaVM::releaseEnvironment(const int environment)
+{
+    if (environment == NO_REFERENCE) {
+        return;
+    }
+    luaL_unref(_state, LUA_REGISTRYINDEX, environment);
+    _environments--;
+}
+
+void LuaVM::addTable(const int environment, const char *table)
+{
+    lua_rawgeti(_state, LUA_REGISTRYINDEX, environment);
+    lua_newtable(_state);
+    lua_setfield(_state, -2, table);
+    lua_pop(_state, 1);
+}
+
+bool LuaVM::pushTable(const int environment, const char *table)
+{
+    lua_rawgeti(_state, LUA_REGISTRYINDEX, environment);
+    if (lua_getfield(_state, -1, table) != LUA_TTABLE) {
+        lua_pop(_state, 2);
+        return false;
+    }
+    lua_remove(_state, -2);
+    return true;
+}
+
+void LuaVM::setNumber(const int environment, const char *table, const char *field, const double value)
+{
+    if (!pushTable(environment, table)) {
+        return;
+    }
+    lua_pushnumber(_state, value);
+    lua_setfield(_state, -2, field);
+    lua_pop(_state, 1);
+}
+
+double LuaVM::getNumber(const int environment, const char *table, const char *field, const double fallback)
+{
+    if (!pushTable(environment, table)) {
+        return fallback;
+    }
+    lua_getfield(_state, -1, field);
+    int isNumber = 0;
+    const double value = lua_tonumberx(_state, -1, &isNumber);
+    lua_pop(_state, 2);
+    return isNumber != 0 ? value : fallback;
+}
+
+void LuaVM::setFlag(const int environment, const char *name, const bool value)
+{
+    lua_rawgeti(_state, LUA_REGISTRYINDEX, environment);
+    lua_pushboolean(_state, value ? 1 : 0);
+    lua_setfield(_state, -2, name);
+    lua_pop(_state, 1);
+}
+
+bool LuaVM::run(const int chunk, const int environment)
+{
+    lua_rawgeti(_state, LUA_REGISTRYINDEX, chunk);
+    lua_rawgeti(_state, LUA_REGISTRYINDEX, environment);
+    if (lua_pcall(_state, 1, 0, 0) != LUA_OK) {
+        const char *message = lua_tostring(_state, -1);
+        this->_log.info << std::string("Lua error: ") + (message != nullptr ? message : "(not a string)") + "\n";
+        lua_pop(_state, 1);
+        return false;
+    }
+    return true;
+}
+
+std::size_t LuaVM::getMemoryUsage() const
+{
+    const auto kilobytes = static_cast<std::size_t>(lua_gc(_state, LUA_GCCOUNT));
+    return kilobytes * 1024 + static_cast<std::size_t>(lua_gc(_state, LUA_GCCOUNTB));
+}
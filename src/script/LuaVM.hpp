@@ -0,0 +1,199 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** LuaVM.hpp
+*/
+
+#ifndef STELLARFORGE_LUAVM_HPP
+#define STELLARFORGE_LUAVM_HPP
+
+#include "StellarForge/Common/utils/Logger.hpp"
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+struct lua_State;
+
+/**
+ * @class LuaVM
+ * @brief One Lua interpreter shared by every scripted object.
+ *
+ * Each script file is compiled once into a function that takes its
+ * environment table as argument, so every object running the script shares
+ * the same bytecode. Each object gets its own environment table: its globals
+ * stay private, and reads of anything it did not define fall back to a
+ * sandbox holding the safe standard functions (no io, os, load, require or
+ * rawset). The math, string, table and utf8 libraries are shared, so the
+ * sandbox only exposes read-only proxies of them: a script writing into one
+ * gets an error instead of changing it for every other object.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class LuaVM {
+public:
+    static constexpr int NO_REFERENCE = -2; ///< Same value as LUA_NOREF
+
+    /**
+     * @brief Gets the interpreter shared by the game.
+     * @return The LuaVM instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static LuaVM &getInstance();
+
+    /**
+     * @brief Opens an interpreter and builds its sandbox.
+     * @throw std::runtime_error If Lua cannot allocate its state.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    LuaVM();
+
+    /**
+     * @brief Closes the interpreter.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~LuaVM();
+
+    LuaVM(const LuaVM &) = delete;
+    LuaVM &operator=(const LuaVM &) = delete;
+
+    /**
+     * @brief Compiles a script, or returns the chunk compiled by an earlier call.
+     * @param path Path of the Lua file.
+     * @return Reference of the compiled chunk.
+     * @throw std::runtime_error If the file cannot be read or does not compile.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    int compile(const std::string &path);
+
+    /**
+     * @brief Creates an empty environment reading through to the sandbox.
+     * @return Reference of the environment table.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    int createEnvironment();
+
+    /**
+     * @brief Drops an environment so Lua can collect it.
+     * @param environment Reference returned by createEnvironment, ignored if NO_REFERENCE.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void releaseEnvironment(int environment);
+
+    /**
+     * @brief Adds an empty table to an environment, for the component bindings.
+     * @param environment Environment reference.
+     * @param table Name of the table.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void addTable(int environment, const char *table);
+
+    /**
+     * @brief Sets a number in a table of an environment.
+     * @param environment Environment reference.
+     * @param table Table added by addTable.
+     * @param field Field name.
+     * @param value New value.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setNumber(int environment, const char *table, const char *field, double value);
+
+    /**
+     * @brief Reads a number from a table of an environment.
+     * @param environment Environment reference.
+     * @param table Table added by addTable.
+     * @param field Field name.
+     * @param fallback Value returned when the field is not a number.
+     * @return The field value.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    double getNumber(int environment, const char *table, const char *field, double fallback);
+
+    /**
+     * @brief Sets a boolean global of an environment.
+     * @param environment Environment reference.
+     * @param name Global name.
+     * @param value New value.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setFlag(int environment, const char *name, bool value);
+
+    /**
+     * @brief Runs a compiled chunk in an environment.
+     * @param chunk Reference returned by compile.
+     * @param environment Reference returned by createEnvironment.
+     * @return False if the script raised an error, which is logged.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool run(int chunk, int environment);
+
+    /**
+     * @brief Gets the memory held by the interpreter.
+     * @return Bytes allocated by Lua.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+    /**
+     * @brief Gets the number of live environments.
+     * @return Environments created and not released.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t getEnvironmentCount() const { return _environments; }
+
+    /**
+     * @brief Gets the number of compiled scripts.
+     * @return Distinct script files compiled.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t getChunkCount() const { return _chunks.size(); }
+
+private:
+    /**
+     * @brief Pushes a table of an environment on the stack.
+     * @param environment Environment reference.
+     * @param table Table name.
+     * @return False, with nothing pushed, if the table does not exist.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool pushTable(int environment, const char *table);
+
+    lua_State *_state = nullptr; ///< The interpreter
+    int _environmentMeta = NO_REFERENCE; ///< Metatable of the environments, reads through to the sandbox
+    std::unordered_map<std::string, int> _chunks; ///< Compiled chunk of each script path
+    std::size_t _environments = 0; ///< Live environments
+    Logger _log; ///< Reports script errors
+};
+
+#endif // STELLARFORGE_LUAVM_HPP
@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** FramePacing.cpp
+*/
+
+#include "FramePacing.hpp"
+#include <algorithm>
+#include <cmath>
+
+void FramePacing::record(const float seconds)
+{
+    _intervals[_next] = seconds;
+    _next = (_next + 1) % WINDOW;
+    _count = std::min(_count + 1, WINDOW);
+}
+
+FramePacingReport FramePacing::report() const
+{
+    FramePacingReport report;
+    report.samples = _count;
+    if (_count == 0) {
+        return report;
+    }
+    std::array<float, WINDOW> sorted = _intervals;
+    std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(_count));
+    double sum = 0;
+    for (std::size_t i = 0; i < _count; i++) {
+        sum += sorted[i];
+    }
+    const double mean = sum / static_cast<double>(_count);
+    double variance = 0;
+    for (std::size_t i = 0; i < _count; i++) {
+        variance += (sorted[i] - mean) * (sorted[i] - mean);
+    }
+    report.mean = static_cast<float>(mean);
+    report.jitter = static_cast<float>(std::sqrt(variance / static_cast<double>(_count)));
+    report.min = sorted[0];
+    report.max = sorted[_count - 1];
+    report.p99 = sorted[std::min(_count - 1, _count * 99 / 100)];
+    return report;
+}
@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** FramePacing.hpp
+*/
+
+#ifndef STELLARFORGE_FRAMEPACING_HPP
+#define STELLARFORGE_FRAMEPACING_HPP
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @struct FramePacingReport
+ * @brief Statistics of the present intervals currently in the window.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct FramePacingReport {
+    std::size_t samples = 0; ///< Intervals in the window
+    float mean = 0; ///< Mean interval in seconds
+    float jitter = 0; ///< Standard deviation of the interval in seconds
+    float min = 0; ///< Shortest interval in seconds
+    float max = 0; ///< Longest interval in seconds
+    float p99 = 0; ///< 99th percentile interval in seconds
+};
+
+/**
+ * @class FramePacing
+ * @brief Sliding window of the intervals between two presented frames.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class FramePacing {
+public:
+    static constexpr std::size_t WINDOW = 600; ///< Intervals kept (10 s at 60 Hz)
+
+    /**
+     * @brief Records the interval since the previous presented frame.
+     * @param seconds Interval in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void record(float seconds);
+
+    /**
+     * @brief Computes the statistics of the window.
+     * @return The pacing statistics.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] FramePacingReport report() const;
+
+private:
+    std::array<float, WINDOW> _intervals {}; ///< Recorded intervals
+    std::size_t _next = 0; ///< Slot of the next interval
+    std::size_t _count = 0; ///< Valid intervals
+};
+
+#endif // STELLARFORGE_FRAMEPACING_HPP
@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameRules.hpp
+*/
+
+#ifndef STELLARFORGE_GAMERULES_HPP
+#define STELLARFORGE_GAMERULES_HPP
+
+/**
+ * @namespace GameRules
+ * @brief Gameplay constants shared by the components and the headless simulation.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+namespace GameRules {
+    constexpr float SCREEN_WIDTH = 1920; ///< Width of the play field
+    constexpr float CEILING = 0; ///< The bird dies above this height
+    constexpr float GROUND = 1000; ///< The bird dies below this height
+
+    constexpr float BIRD_X = 100; ///< Horizontal position of the bird
+    constexpr float BIRD_WIDTH = 90; ///< Width of the bird collider
+    constexpr float BIRD_HEIGHT = 60; ///< Height of the bird collider
+    constexpr float BIRD_START_VELOCITY = 100; ///< Vertical velocity of the bird on start
+    constexpr float BIRD_GRAVITY = 500; ///< Vertical acceleration of the living bird
+    constexpr float BIRD_TERMINAL_VELOCITY = 500; ///< Terminal velocity of the living bird
+    constexpr float BIRD_JUMP_FORCE = 250; ///< Upward velocity given by a jump
+    constexpr float BIRD_DEATH_VELOCITY = 100; ///< Vertical velocity of the bird when it dies
+    constexpr float BIRD_DEATH_GRAVITY = 1000; ///< Vertical acceleration of the dead bird
+
+    constexpr float PIPE_WIDTH = 140; ///< Width of a pipe pair
+    constexpr float PIPE_HEIGHT = 890; ///< Length of each pipe of a pair, from the gap outwards
+    constexpr float PIPE_SPEED = 300; ///< Horizontal speed of the pipes
+    constexpr float PIPE_SPAWN_RATE = 2; ///< Seconds between two pipe pairs
+    constexpr float PIPE_SPAWN_X = 2000; ///< Horizontal position pipes spawn at
+    constexpr float PIPE_RETIRE_X = -200; ///< Pipe pairs are removed once their left edge is past this position
+    constexpr float PIPE_GAP = 300; ///< Default height of the gap between a pipe pair, see Simulation::configuredPipeGap
+    constexpr float PIPE_GAP_CENTRE = 500; ///< Vertical centre of the gap before its random offset
+    constexpr int PIPE_GAP_RANGE = 200; ///< Maximum vertical offset of the gap centre
+
+    constexpr float SCORE_FIRST_DELAY = 8.5f; ///< Seconds before the first point
+    constexpr float SCORE_DELAY = 2; ///< Seconds between two points
+
+    constexpr float BACKGROUND_SPEED = 500; ///< Horizontal scrolling speed of the background
+}
+
+#endif // STELLARFORGE_GAMERULES_HPP
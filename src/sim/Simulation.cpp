@@ -0,0 +1,334 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Simulation.cpp
+*/
+
+#include "Simulation.hpp"
+#include <algorithm>
+#include "GameRules.hpp"
+#include "src/utils/Random.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace {
+    constexpr double NEVER = std::numeric_limits<double>::infinity();
+
+    // Part of a step during which the bird's acceleration is constant.
+    struct Arc {
+        double y; // Height at start
+        double v; // Vertical velocity at start
+        double a; // Vertical acceleration
+        double start; // Seconds into the step the arc begins at
+        double end; // Seconds into the step the arc ends at
+    };
+
+    float heightAt(const Arc &arc, const double time)
+    {
+        const double s = time - arc.start;
+        return static_cast<float>(arc.y + arc.v * s + arc.a * s * s / 2);
+    }
+
+    double speedAt(const Arc &arc, const double time)
+    {
+        return arc.v + arc.a * (time - arc.start);
+    }
+
+    // Splits a step where the bird reaches its terminal velocity, the speed stays constant afterwards.
+    int splitFlight(const GameSnapshot &state, const float dt, Arc arcs[2])
+    {
+        const double terminal = state.birdTerminalVelocity;
+        double v = state.birdVelocityY;
+        const double a = state.birdAccelerationY;
+        if (terminal > 0) {
+            v = std::clamp(v, -terminal, terminal);
+        }
+        double limit = NEVER;
+        if (terminal > 0 && a != 0) {
+            limit = ((a > 0 ? terminal : -terminal) - v) / a;
+        }
+        if (limit >= dt) {
+            arcs[0] = {state.birdY, v, a, 0, dt};
+            return 1;
+        }
+        arcs[0] = {state.birdY, v, a, 0, limit};
+        arcs[1] = {heightAt(arcs[0], limit), a > 0 ? terminal : -terminal, 0, limit, dt};
+        return 2;
+    }
+
+    // Times in [from, to] at which the arc is exactly at a height, in increasing order.
+    int solve(const Arc &arc, const double level, const double from, const double to, double roots[2])
+    {
+        const double a = arc.a / 2;
+        const double b = arc.v;
+        const double c = arc.y - level;
+        double found[2];
+        int count = 0;
+        if (std::abs(a) < 1e-9) {
+            if (b != 0) {
+                found[count++] = -c / b;
+            }
+        } else {
+            const double discriminant = b * b - 4 * a * c;
+            if (discriminant < 0) {
+                return 0;
+            }
+            // Stable form, avoids cancelling b against the square root.
+            const double q = -(b + std::copysign(std::sqrt(discriminant), b)) / 2;
+            found[count++] = q / a;
+            if (q != 0) {
+                found[count++] = c / q;
+            }
+        }
+        int kept = 0;
+        for (int i = 0; i < count; i++) {
+            const double time = arc.start + found[i];
+            if (time >= from && time <= to) {
+                roots[kept++] = time;
+            }
+        }
+        if (kept == 2 && roots[1] < roots[0]) {
+            std::swap(roots[0], roots[1]);
+        }
+        return kept;
+    }
+
+    // First time in [from, to] the arc goes past a height, downward (direction -1) or upward (1).
+    double firstCrossing(const Arc &arc, const double level, const int direction, const double from, const double to)
+    {
+        if (from > to) {
+            return NEVER;
+        }
+        if ((heightAt(arc, from) - level) * direction > 0) {
+            return from;
+        }
+        double roots[2];
+        const int count = solve(arc, level, from, to, roots);
+        for (int i = 0; i < count; i++) {
+            if (speedAt(arc, roots[i]) * direction > 0) {
+                return roots[i];
+            }
+        }
+        return NEVER;
+    }
+
+    // First time in [from, to) the arc is strictly between two heights.
+    double firstInside(const Arc &arc, const double low, const double high, const double from, const double to)
+    {
+        if (from >= to) {
+            return NEVER;
+        }
+        if (const float y = heightAt(arc, from); y > low && y < high) {
+            return from;
+        }
+        double first = NEVER;
+        double roots[2];
+        for (int i = solve(arc, low, from, to, roots); i-- > 0;) {
+            if (speedAt(arc, roots[i]) > 0) {
+                first = std::min(first, roots[i]);
+            }
+        }
+        for (int i = solve(arc, high, from, to, roots); i-- > 0;) {
+            if (speedAt(arc, roots[i]) < 0) {
+                first = std::min(first, roots[i]);
+            }
+        }
+        return first < to ? first : NEVER;
+    }
+}
+
+void Simulation::reset(GameSnapshot &state, const std::uint32_t seed)
+{
+    state = GameSnapshot();
+    state.birdX = GameRules::BIRD_X;
+    state.birdVelocityY = GameRules::BIRD_START_VELOCITY;
+    state.birdAccelerationY = GameRules::BIRD_GRAVITY;
+    state.birdTerminalVelocity = GameRules::BIRD_TERMINAL_VELOCITY;
+    state.scoreDelay = GameRules::SCORE_FIRST_DELAY;
+    state.pipeGap = configuredPipeGap();
+    state.rngState = Random(seed).getState();
+}
+
+float Simulation::configuredPipeGap()
+{
+    static const float gap = []() {
+        const char *value = std::getenv("FLAPPY_PIPE_GAP");
+        const float parsed = value != nullptr && *value != '\0' ? std::strtof(value, nullptr) : 0;
+        return std::isfinite(parsed) && parsed > 0 ? parsed : GameRules::PIPE_GAP;
+    }();
+    return gap;
+}
+
+Contact Simulation::step(GameSnapshot &state, const bool jump, const float dt)
+{
+    if (jump && !state.birdDead) {
+        state.birdVelocityY = -GameRules::BIRD_JUMP_FORCE;
+    }
+    const Contact contact = state.birdDead ? Contact() : sweepBird(state, dt);
+    const float flight = contact.impact == Impact::NONE ? dt : contact.time;
+    advanceWorld(state, flight);
+    moveBird(state, flight);
+    if (contact.impact != Impact::NONE) {
+        killBird(state);
+        advanceWorld(state, dt - flight);
+        moveBird(state, dt - flight);
+    }
+    state.tick++;
+    return contact;
+}
+
+void Simulation::moveBird(GameSnapshot &state, const float dt)
+{
+    Arc arcs[2];
+    const int count = splitFlight(state, dt, arcs);
+    const Arc &last = arcs[count - 1];
+    state.birdY = heightAt(last, dt);
+    state.birdVelocityY = static_cast<float>(speedAt(last, dt));
+    state.birdX += state.birdVelocityX * dt;
+}
+
+Contact Simulation::sweepBird(const GameSnapshot &state, const float dt)
+{
+    Contact contact;
+    double first = NEVER;
+    const auto consider = [&](const double time, const Impact impact) {
+        if (time < first) {
+            first = time;
+            contact.impact = impact;
+        }
+    };
+    Arc arcs[2];
+    const int count = splitFlight(state, dt, arcs);
+    for (int i = 0; i < count; i++) {
+        consider(firstCrossing(arcs[i], GameRules::CEILING, -1, arcs[i].start, arcs[i].end), Impact::CEILING);
+        consider(firstCrossing(arcs[i], GameRules::GROUND, 1, arcs[i].start, arcs[i].end), Impact::GROUND);
+    }
+    // In the pipe's frame the bird slides right at the pipe speed, so the overlap on x is a single time window.
+    const double slide = static_cast<double>(state.birdVelocityX) + state.pipeSpeed;
+    for (std::uint8_t p = 0; p < state.pipeCount; p++) {
+        const PipeSnapshot &pipe = state.pipes[p];
+        const double offset = state.birdX - pipe.x;
+        double enter = 0;
+        double leave = dt;
+        if (slide != 0) {
+            enter = (-GameRules::BIRD_WIDTH - offset) / slide;
+            leave = (GameRules::PIPE_WIDTH - offset) / slide;
+            if (slide < 0) {
+                std::swap(enter, leave);
+            }
+        } else if (offset <= -GameRules::BIRD_WIDTH || offset >= GameRules::PIPE_WIDTH) {
+            continue;
+        }
+        // Within the column the pair is solid above and below the gap.
+        const double gapTop = pipe.gapTop();
+        const double gapBottom = pipe.gapBottom();
+        for (int i = 0; i < count; i++) {
+            const double from = std::max(enter, arcs[i].start);
+            const double to = std::min(leave, arcs[i].end);
+            consider(firstInside(arcs[i], gapTop - GameRules::PIPE_HEIGHT - GameRules::BIRD_HEIGHT, gapTop, from, to), Impact::PIPE);
+            consider(firstInside(arcs[i], gapBottom - GameRules::BIRD_HEIGHT, gapBottom + GameRules::PIPE_HEIGHT, from, to), Impact::PIPE);
+        }
+    }
+    contact.time = contact.impact == Impact::NONE ? 0 : static_cast<float>(first);
+    return contact;
+}
+
+bool Simulation::birdHitsPipe(const GameSnapshot &state)
+{
+    const float birdRight = state.birdX + GameRules::BIRD_WIDTH;
+    const float birdBottom = state.birdY + GameRules::BIRD_HEIGHT;
+    for (std::uint8_t i = 0; i < state.pipeCount; i++) {
+        const PipeSnapshot &pipe = state.pipes[i];
+        if (state.birdX >= pipe.x + GameRules::PIPE_WIDTH || birdRight <= pipe.x) {
+            continue;
+        }
+        const float gapTop = pipe.gapTop();
+        const float gapBottom = pipe.gapBottom();
+        if ((state.birdY < gapTop && birdBottom > gapTop - GameRules::PIPE_HEIGHT)
+            || (state.birdY < gapBottom + GameRules::PIPE_HEIGHT && birdBottom > gapBottom)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::uint32_t Simulation::checksum(const GameSnapshot &state)
+{
+    std::uint8_t buffer[SNAPSHOT_MAX_ENCODED_SIZE];
+    const std::size_t size = encodeSnapshot(state, buffer, sizeof(buffer));
+    std::uint32_t hash = 2166136261u;
+    for (std::size_t i = 0; i < size; i++) {
+        hash = (hash ^ buffer[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void Simulation::advanceWorld(GameSnapshot &state, const float dt)
+{
+    std::uint8_t kept = 0;
+    for (std::uint8_t i = 0; i < state.pipeCount; i++) {
+        state.pipes[i].x -= state.pipeSpeed * dt;
+        if (state.pipes[i].x >= GameRules::PIPE_RETIRE_X) {
+            state.pipes[kept++] = state.pipes[i];
+        }
+    }
+    state.pipeCount = kept;
+    if (state.gameOver) {
+        return;
+    }
+    runSpawner(state.pipeTimer, GameRules::PIPE_SPAWN_RATE, state.rngState, dt, [&state](const float offset, const float age) {
+        spawnPipe(state, GameRules::PIPE_GAP_CENTRE + offset, age);
+    });
+    state.score += runScoreTimer(state.scoreTimer, state.scoreDelay, dt);
+    scrollBackground(state.backgroundX, GameRules::BACKGROUND_SPEED * dt);
+}
+
+unsigned Simulation::runScoreTimer(float &timer, float &delay, const float dt)
+{
+    unsigned points = 0;
+    timer += dt;
+    while (timer >= delay) {
+        timer -= delay;
+        points++;
+        delay = GameRules::SCORE_DELAY;
+    }
+    return points;
+}
+
+bool Simulation::scrollBackground(float &x, const float distance)
+{
+    x -= distance;
+    if (x > -GameRules::SCREEN_WIDTH) {
+        return false;
+    }
+    x += GameRules::SCREEN_WIDTH;
+    return true;
+}
+
+float Simulation::nextGapOffset(std::uint32_t &rngState)
+{
+    Random random(rngState);
+    const int offset = random.range(-GameRules::PIPE_GAP_RANGE, GameRules::PIPE_GAP_RANGE);
+    rngState = random.getState();
+    return static_cast<float>(offset);
+}
+
+void Simulation::spawnPipe(GameSnapshot &state, const float gapCentre, const float age)
+{
+    if (state.pipeCount >= GameSnapshot::MAX_PIPES) {
+        return;
+    }
+    state.pipes[state.pipeCount++] = {GameRules::PIPE_SPAWN_X - state.pipeSpeed * age, gapCentre, state.pipeGap};
+}
+
+void Simulation::killBird(GameSnapshot &state)
+{
+    state.birdDead = true;
+    state.gameOver = true;
+    state.birdVelocityY = GameRules::BIRD_DEATH_VELOCITY;
+    state.birdAccelerationY = GameRules::BIRD_DEATH_GRAVITY;
+    state.birdTerminalVelocity = 0;
+    state.pipeCount = 0;
+}
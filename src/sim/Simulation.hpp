@@ -0,0 +1,193 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Simulation.hpp
+*/
+
+#ifndef STELLARFORGE_SIMULATION_HPP
+#define STELLARFORGE_SIMULATION_HPP
+
+#include "src/state/GameSnapshot.hpp"
+
+/**
+ * @enum Impact
+ * @brief What the bird ran into during a step.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+enum class Impact : std::uint8_t {
+    NONE, ///< The bird flew the whole step
+    CEILING, ///< Crossed the ceiling bound
+    GROUND, ///< Crossed the ground bound
+    PIPE ///< Touched a pipe collider
+};
+
+/**
+ * @struct Contact
+ * @brief First impact found by a swept test.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct Contact {
+    Impact impact = Impact::NONE; ///< What was hit
+    float time = 0; ///< Seconds into the step the impact happens at
+};
+
+/**
+ * @class Simulation
+ * @brief Deterministic fixed-step model of the Bird, Pipes and Score rules.
+ *
+ * Works on a GameSnapshot only, without any engine object, so a tick can be
+ * replayed as many times as needed (rollback, fast-forward, headless runs).
+ * Given the same seed and the same inputs it always produces the same state.
+ *
+ * The bird follows its trajectory in closed form and collisions are swept
+ * over the whole step, so a long step gives the same deaths as many short
+ * ones instead of tunnelling through a pipe.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class Simulation {
+public:
+    /**
+     * @brief Puts a snapshot in the state of a new game.
+     * @param state Snapshot to reset.
+     * @param seed Seed of the pipe course.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void reset(GameSnapshot &state, std::uint32_t seed);
+
+    /**
+     * @brief Gets the gap height between the pipes of a pair for this run.
+     *
+     * Read once from the FLAPPY_PIPE_GAP environment variable, GameRules::PIPE_GAP
+     * when it is unset or not a positive number. The game builds its pipe pair
+     * texture and spawns its pairs with it, and reset puts it in every new game,
+     * so the game, flappy-headless and flappy-race all collide the same gap.
+     * @return The gap height in pixels.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] static float configuredPipeGap();
+
+    /**
+     * @brief Advances a snapshot by one tick.
+     * @param state Snapshot to advance.
+     * @param jump True if the jump input is held on this tick.
+     * @param dt Duration of the tick in seconds.
+     * @return The impact that killed the bird during the tick, if any.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static Contact step(GameSnapshot &state, bool jump, float dt);
+
+    /**
+     * @brief Moves the bird along its trajectory, clamping its speed to the terminal velocity.
+     * @param state Snapshot holding the bird.
+     * @param dt Duration to fly for in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static void moveBird(GameSnapshot &state, float dt);
+
+    /**
+     * @brief Finds the first time the bird leaves the play field or touches a pipe during a step.
+     *
+     * The bird collider follows its trajectory while the pipes move at the
+     * snapshot's pipe speed. Pipes spawned during the step are ignored, they
+     * appear far out of reach.
+     * @param state Snapshot at the start of the step.
+     * @param dt Duration of the step in seconds.
+     * @return The earliest impact, Impact::NONE if the bird survives the step.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] static Contact sweepBird(const GameSnapshot &state, float dt);
+
+    /**
+     * @brief Checks whether the bird overlaps one of the live pipe pairs.
+     * @param state Snapshot to check.
+     * @return True if the bird collider overlaps a pipe above or below a gap.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] static bool birdHitsPipe(const GameSnapshot &state);
+
+    /**
+     * @brief Computes a checksum of a snapshot, used to detect desyncs.
+     * @param state Snapshot to hash.
+     * @return FNV-1a hash of the encoded snapshot.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] static std::uint32_t checksum(const GameSnapshot &state);
+
+    /**
+     * @brief Runs the pipe spawner over a step.
+     *
+     * Shared by step and the Pipes component, so the game spawns its pairs
+     * exactly like flappy-headless and flappy-race.
+     * @param timer Seconds since the last spawn, keeps the overshoot.
+     * @param period Seconds between two spawns, nothing spawns if not positive.
+     * @param rngState State of the pipe course generator.
+     * @param dt Step length in seconds.
+     * @param spawn Called with the gap offset from GameRules::PIPE_GAP_CENTRE and the age in seconds of each pair due.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    template <typename Spawn>
+    static void runSpawner(float &timer, const float period, std::uint32_t &rngState, const float dt, Spawn &&spawn)
+    {
+        timer += dt;
+        // The overshoot is kept so pairs land at the same time and place whatever the step length, even several per step.
+        while (period > 0 && timer >= period) {
+            timer -= period;
+            const float offset = nextGapOffset(rngState);
+            spawn(offset, timer);
+        }
+    }
+
+    /**
+     * @brief Runs the score timer over a step, shared by step and the Score component.
+     * @param timer Seconds since the last point, keeps the overshoot.
+     * @param delay Seconds required for the next point, GameRules::SCORE_DELAY once one is scored.
+     * @param dt Step length in seconds.
+     * @return Points scored during the step.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static unsigned runScoreTimer(float &timer, float &delay, float dt);
+
+    /**
+     * @brief Scrolls the background, shared by step and the Background component.
+     * @param x Scroll position, wrapped back by one screen width past -GameRules::SCREEN_WIDTH.
+     * @param distance Pixels scrolled.
+     * @return True if the position wrapped.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static bool scrollBackground(float &x, float distance);
+
+private:
+    static float nextGapOffset(std::uint32_t &rngState);
+    static void advanceWorld(GameSnapshot &state, float dt);
+    static void spawnPipe(GameSnapshot &state, float gapCentre, float age);
+    static void killBird(GameSnapshot &state);
+};
+
+#endif // STELLARFORGE_SIMULATION_HPP
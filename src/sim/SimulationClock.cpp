@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SimulationClock.cpp
+*/
+
+#include "SimulationClock.hpp"
+#include <algorithm>
+
+SimulationClock &SimulationClock::getInstance()
+{
+    static SimulationClock instance;
+    return instance;
+}
+
+SimulationClock::SimulationClock(const float tickRate)
+    : _step(1.0f / tickRate)
+{
+}
+
+void SimulationClock::setTickRate(const float tickRate)
+{
+    if (tickRate > 0) {
+        _step = 1.0f / tickRate;
+        _accumulator = 0;
+    }
+}
+
+void SimulationClock::beginFrame()
+{
+    const auto now = Clock::now();
+    if (!_started) {
+        _started = true;
+        _lastFrame = now;
+        _steps = 0;
+        _frameTime = 0;
+        return;
+    }
+    const float elapsed = std::chrono::duration<float>(now - _lastFrame).count();
+    _lastFrame = now;
+    beginFrame(elapsed);
+}
+
+void SimulationClock::beginFrame(const float elapsed)
+{
+    _frameTime = elapsed;
+    _pacing.record(elapsed);
+    _accumulator += elapsed;
+    const auto due = static_cast<std::uint64_t>(_accumulator / _step);
+    _accumulator -= static_cast<float>(due) * _step;
+    _steps = static_cast<unsigned>(std::min<std::uint64_t>(due, MAX_STEPS_PER_FRAME));
+    _dropped += due - _steps;
+    _tick += _steps;
+}
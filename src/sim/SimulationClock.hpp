@@ -0,0 +1,153 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SimulationClock.hpp
+*/
+
+#ifndef STELLARFORGE_SIMULATIONCLOCK_HPP
+#define STELLARFORGE_SIMULATIONCLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include "FramePacing.hpp"
+
+/**
+ * @class SimulationClock
+ * @brief Fixed-step accumulator separating the simulation rate from the frame rate.
+ *
+ * Once per presented frame, beginFrame converts the elapsed time into a
+ * whole number of simulation steps and an interpolation factor. Gameplay
+ * components run that many fixed steps, then present their Transform at
+ * previous + (current - previous) * alpha.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SimulationClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr float DEFAULT_TICK_RATE = 60; ///< Simulation steps per second
+    static constexpr unsigned MAX_STEPS_PER_FRAME = 8; ///< Steps run at most in one frame, the rest is dropped
+
+    /**
+     * @brief Gets the clock shared by the gameplay components.
+     * @return The SimulationClock instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static SimulationClock &getInstance();
+
+    /**
+     * @brief Constructor for the SimulationClock class.
+     * @param tickRate Simulation steps per second.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit SimulationClock(float tickRate = DEFAULT_TICK_RATE);
+
+    /**
+     * @brief Starts a presented frame: accumulates the elapsed time into steps.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void beginFrame();
+
+    /**
+     * @brief Starts a presented frame with an explicit elapsed time.
+     * @param elapsed Seconds since the previous frame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void beginFrame(float elapsed);
+
+    /**
+     * @brief Sets the simulation rate.
+     * @param tickRate Simulation steps per second.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setTickRate(float tickRate);
+
+    /**
+     * @brief Gets the number of steps to run on this frame.
+     * @return The number of steps.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] unsigned getSteps() const { return _steps; }
+
+    /**
+     * @brief Gets the duration of a step.
+     * @return The step duration in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float getStep() const { return _step; }
+
+    /**
+     * @brief Gets how far the frame is between the last two simulation states.
+     * @return Interpolation factor in [0, 1).
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float getAlpha() const { return _accumulator / _step; }
+
+    /**
+     * @brief Gets the time between the previous frame and this one.
+     * @return The frame time in seconds, 0 on the first frame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float getFrameTime() const { return _frameTime; }
+
+    /**
+     * @brief Gets the number of steps run since the start.
+     * @return The simulation tick.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getTick() const { return _tick; }
+
+    /**
+     * @brief Gets the number of steps dropped because a frame took too long.
+     * @return The number of dropped steps.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getDroppedSteps() const { return _dropped; }
+
+    /**
+     * @brief Gets the present interval statistics.
+     * @return The frame pacing window.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const FramePacing &getPacing() const { return _pacing; }
+
+private:
+    float _step; ///< Duration of a step in seconds
+    float _accumulator = 0; ///< Time not simulated yet
+    unsigned _steps = 0; ///< Steps to run on this frame
+    float _frameTime = 0; ///< Time since the previous frame
+    std::uint64_t _tick = 0; ///< Steps run since the start
+    std::uint64_t _dropped = 0; ///< Steps dropped
+    bool _started = false; ///< A frame was already seen
+    Clock::time_point _lastFrame; ///< Time of the previous frame
+    FramePacing _pacing; ///< Present interval statistics
+};
+
+#endif // STELLARFORGE_SIMULATIONCLOCK_HPP
@@ -0,0 +1,136 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorDecoder.cpp
+*/
+
+#include "SpectatorDecoder.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "SpectatorProtocol.hpp"
+#include "src/utils/Varint.hpp"
+
+using namespace SpectatorProtocol;
+
+namespace {
+    std::uint32_t readUnsigned(const std::uint8_t *&cursor, const std::uint8_t *end)
+    {
+        std::uint32_t value = 0;
+        if (!Varint::read(cursor, end, value)) {
+            throw std::runtime_error("SpectatorDecoder: truncated record");
+        }
+        return value;
+    }
+
+    std::int32_t readSigned(const std::uint8_t *&cursor, const std::uint8_t *end)
+    {
+        return Varint::unzigzag(readUnsigned(cursor, end));
+    }
+}
+
+std::size_t SpectatorDecoder::readHeader(const std::uint8_t *data, const std::size_t size)
+{
+    const std::uint8_t *end = data + size;
+    if (size < sizeof(MAGIC) + 1) {
+        return 0;
+    }
+    if (!std::equal(MAGIC, MAGIC + sizeof(MAGIC), data) || data[sizeof(MAGIC)] != VERSION) {
+        throw std::runtime_error("SpectatorDecoder: not a spectator stream");
+    }
+    const std::uint8_t *cursor = data + sizeof(MAGIC) + 1;
+    std::uint32_t tickRate = 0;
+    std::uint32_t keyframeInterval = 0;
+    std::uint32_t pipeSpeed = 0;
+    if (!Varint::read(cursor, end, tickRate) || !Varint::read(cursor, end, keyframeInterval)
+        || !Varint::read(cursor, end, pipeSpeed)) {
+        return 0;
+    }
+    if (tickRate == 0) {
+        throw std::runtime_error("SpectatorDecoder: invalid tick rate");
+    }
+    _tickRate = tickRate;
+    _keyframeInterval = keyframeInterval;
+    _pipeSpeed = dequantize(static_cast<std::int32_t>(pipeSpeed));
+    return static_cast<std::size_t>(cursor - data);
+}
+
+std::size_t SpectatorDecoder::readRecord(const std::uint8_t *data, const std::size_t size)
+{
+    const std::uint8_t *cursor = data;
+    std::uint32_t length = 0;
+    if (!Varint::read(cursor, data + size, length) || static_cast<std::size_t>(cursor - data) + length > size) {
+        return 0;
+    }
+    const std::uint8_t *end = cursor + length;
+    const std::size_t consumed = static_cast<std::size_t>(end - data);
+    if (length == 0) {
+        throw std::runtime_error("SpectatorDecoder: empty record");
+    }
+    const std::uint8_t flags = *cursor++;
+    _lastFlags = flags;
+    if ((flags & FLAG_KEYFRAME) != 0) {
+        _view.tick = readUnsigned(cursor, end);
+        _birdX = readSigned(cursor, end);
+        _birdY = readSigned(cursor, end);
+        _view.score = readUnsigned(cursor, end);
+        if (cursor >= end) {
+            throw std::runtime_error("SpectatorDecoder: truncated record");
+        }
+        const std::uint8_t state = *cursor++;
+        _view.birdDead = (state & STATE_BIRD_DEAD) != 0;
+        _view.gameOver = (state & STATE_GAME_OVER) != 0;
+        const std::uint32_t count = readUnsigned(cursor, end);
+        if (count > GameSnapshot::MAX_PIPES) {
+            throw std::runtime_error("SpectatorDecoder: too many pipes");
+        }
+        _view.pipeCount = static_cast<std::uint8_t>(count);
+        for (std::uint32_t i = 0; i < count; i++) {
+            readPipe(cursor, end, _view.pipes[i]);
+        }
+        _synchronized = true;
+    } else if (_synchronized) {
+        _view.tick++;
+        const float step = _pipeSpeed / static_cast<float>(_tickRate);
+        for (std::uint8_t i = 0; i < _view.pipeCount; i++) {
+            _view.pipes[i].x -= step;
+        }
+        if ((flags & FLAG_BIRD_MOVED) != 0) {
+            _birdY += readSigned(cursor, end);
+        }
+        if ((flags & FLAG_SCORE) != 0) {
+            _view.score = readUnsigned(cursor, end);
+        }
+        if ((flags & FLAG_PIPES_RETIRED) != 0) {
+            const std::uint32_t retired = std::min<std::uint32_t>(readUnsigned(cursor, end), _view.pipeCount);
+            std::copy(_view.pipes + retired, _view.pipes + _view.pipeCount, _view.pipes);
+            _view.pipeCount = static_cast<std::uint8_t>(_view.pipeCount - retired);
+        }
+        if ((flags & FLAG_PIPES_SPAWNED) != 0) {
+            const std::uint32_t spawned = readUnsigned(cursor, end);
+            if (_view.pipeCount + spawned > GameSnapshot::MAX_PIPES) {
+                throw std::runtime_error("SpectatorDecoder: too many pipes");
+            }
+            for (std::uint32_t i = 0; i < spawned; i++) {
+                readPipe(cursor, end, _view.pipes[_view.pipeCount++]);
+            }
+        }
+        if ((flags & FLAG_BIRD_DIED) != 0) {
+            _view.birdDead = true;
+            _view.gameOver = true;
+        }
+        if ((flags & FLAG_BIRD_SHIFTED) != 0) {
+            _birdX += readSigned(cursor, end);
+        }
+    }
+    _view.birdX = dequantize(_birdX);
+    _view.birdY = dequantize(_birdY);
+    return consumed;
+}
+
+void SpectatorDecoder::readPipe(const std::uint8_t *&cursor, const std::uint8_t *end, PipeSnapshot &pipe) const
+{
+    pipe.x = dequantize(readSigned(cursor, end));
+    pipe.gapCentre = dequantize(readSigned(cursor, end));
+    pipe.gapHeight = dequantize(static_cast<std::int32_t>(readUnsigned(cursor, end)));
+}
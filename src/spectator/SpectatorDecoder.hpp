@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorDecoder.hpp
+*/
+
+#ifndef STELLARFORGE_SPECTATORDECODER_HPP
+#define STELLARFORGE_SPECTATORDECODER_HPP
+
+#include <cstddef>
+#include "src/state/GameSnapshot.hpp"
+
+/**
+ * @class SpectatorDecoder
+ * @brief Rebuilds the play state from a spectator stream.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SpectatorDecoder {
+public:
+    /**
+     * @brief Reads the stream header.
+     * @param data Received bytes.
+     * @param size Number of received bytes.
+     * @return Number of bytes consumed, 0 if the header is not complete yet.
+     * @throws std::runtime_error if the bytes are not a spectator stream.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::size_t readHeader(const std::uint8_t *data, std::size_t size);
+
+    /**
+     * @brief Applies the next record to the view.
+     * @param data Received bytes.
+     * @param size Number of received bytes.
+     * @return Number of bytes consumed, 0 if the record is not complete yet.
+     * @throws std::runtime_error if the record is malformed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::size_t readRecord(const std::uint8_t *data, std::size_t size);
+
+    /**
+     * @brief Gets the rebuilt state. Only the bird position, score, flags and pipes are filled.
+     * @return The state after the last record.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const GameSnapshot &getView() const { return _view; }
+
+    /**
+     * @brief Gets the flags of the last record.
+     * @return The SpectatorProtocol flags of the last record.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint8_t getLastFlags() const { return _lastFlags; }
+
+    /**
+     * @brief Tells whether a keyframe was read, before that the view is meaningless.
+     * @return True once a keyframe was read.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] bool isSynchronized() const { return _synchronized; }
+
+    /**
+     * @brief Gets the tick rate announced in the header.
+     * @return Ticks per second.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getTickRate() const { return _tickRate; }
+
+    /**
+     * @brief Gets the keyframe interval announced in the header.
+     * @return Ticks between two keyframes.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getKeyframeInterval() const { return _keyframeInterval; }
+
+private:
+    void readPipe(const std::uint8_t *&cursor, const std::uint8_t *end, PipeSnapshot &pipe) const;
+
+    std::uint32_t _tickRate = 0; ///< Ticks per second
+    std::uint32_t _keyframeInterval = 0; ///< Ticks between two keyframes
+    float _pipeSpeed = 0; ///< Horizontal speed of the pipes
+    std::int32_t _birdX = 0; ///< Quantized bird position
+    std::int32_t _birdY = 0; ///< Quantized bird position
+    bool _synchronized = false; ///< A keyframe was read
+    std::uint8_t _lastFlags = 0; ///< Flags of the last record
+    GameSnapshot _view; ///< Rebuilt state
+};
+
+#endif // STELLARFORGE_SPECTATORDECODER_HPP
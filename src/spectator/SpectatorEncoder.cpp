@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorEncoder.cpp
+*/
+
+#include "SpectatorEncoder.hpp"
+#include <cmath>
+#include "SpectatorProtocol.hpp"
+#include "src/utils/Varint.hpp"
+
+using namespace SpectatorProtocol;
+
+SpectatorEncoder::SpectatorEncoder(const std::uint32_t tickRate, const std::uint32_t keyframeInterval, const float pipeSpeed)
+    : _tickRate(tickRate), _keyframeInterval(keyframeInterval), _pipeSpeed(pipeSpeed)
+{
+    _record.reserve(SNAPSHOT_MAX_ENCODED_SIZE);
+}
+
+void SpectatorEncoder::writeHeader(std::vector<std::uint8_t> &out) const
+{
+    out.insert(out.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    out.push_back(VERSION);
+    Varint::write(out, _tickRate);
+    Varint::write(out, _keyframeInterval);
+    Varint::write(out, static_cast<std::uint32_t>(quantize(_pipeSpeed)));
+}
+
+void SpectatorEncoder::encode(const GameSnapshot &snapshot, std::vector<std::uint8_t> &out)
+{
+    std::uint32_t retired = 0;
+    const bool revived = _previous.birdDead && !snapshot.birdDead;
+    const bool consistent = diffPipes(snapshot, retired) && !revived && snapshot.tick == _previous.tick + 1;
+
+    _record.clear();
+    if (_forceKeyframe || !consistent || _ticksSinceKeyframe + 1 >= _keyframeInterval) {
+        writeKeyframe(snapshot);
+    } else {
+        _ticksSinceKeyframe++;
+        std::uint8_t flags = 0;
+        const std::int32_t birdX = quantize(snapshot.birdX);
+        const std::int32_t birdY = quantize(snapshot.birdY);
+        const std::uint32_t kept = _previous.pipeCount - retired;
+        if (birdY != _birdY) {
+            flags |= FLAG_BIRD_MOVED;
+        }
+        if (birdX != _birdX) {
+            flags |= FLAG_BIRD_SHIFTED;
+        }
+        if (snapshot.score != _previous.score) {
+            flags |= FLAG_SCORE;
+        }
+        if (retired > 0) {
+            flags |= FLAG_PIPES_RETIRED;
+        }
+        if (snapshot.pipeCount > kept) {
+            flags |= FLAG_PIPES_SPAWNED;
+        }
+        if (snapshot.birdDead && !_previous.birdDead) {
+            flags |= FLAG_BIRD_DIED;
+        }
+        _record.push_back(flags);
+        if ((flags & FLAG_BIRD_MOVED) != 0) {
+            Varint::writeSigned(_record, birdY - _birdY);
+            _birdY = birdY;
+        }
+        if ((flags & FLAG_SCORE) != 0) {
+            Varint::write(_record, snapshot.score);
+        }
+        if ((flags & FLAG_PIPES_RETIRED) != 0) {
+            Varint::write(_record, retired);
+        }
+        if ((flags & FLAG_PIPES_SPAWNED) != 0) {
+            Varint::write(_record, snapshot.pipeCount - kept);
+            for (std::uint32_t i = kept; i < snapshot.pipeCount; i++) {
+                writePipe(snapshot.pipes[i]);
+            }
+        }
+        if ((flags & FLAG_BIRD_SHIFTED) != 0) {
+            Varint::writeSigned(_record, birdX - _birdX);
+            _birdX = birdX;
+        }
+    }
+    Varint::write(out, static_cast<std::uint32_t>(_record.size()));
+    out.insert(out.end(), _record.begin(), _record.end());
+    _previous = snapshot;
+}
+
+bool SpectatorEncoder::diffPipes(const GameSnapshot &snapshot, std::uint32_t &retired) const
+{
+    // Pipe pairs retire from the front of the list and spawn at its back, and
+    // a gap never moves vertically: find how many leading pairs are gone,
+    // then check the rest still lines up.
+    const float maxStep = 2 * _pipeSpeed / static_cast<float>(_tickRate) + 1;
+    const auto same = [maxStep](const PipeSnapshot &before, const PipeSnapshot &after) {
+        return before.gapCentre == after.gapCentre && before.gapHeight == after.gapHeight && std::fabs(before.x - after.x) <= maxStep;
+    };
+    retired = 0;
+    while (retired < _previous.pipeCount && (snapshot.pipeCount == 0 || !same(_previous.pipes[retired], snapshot.pipes[0]))) {
+        retired++;
+    }
+    const std::uint32_t kept = _previous.pipeCount - retired;
+    if (kept > snapshot.pipeCount) {
+        return false;
+    }
+    for (std::uint32_t i = 0; i < kept; i++) {
+        if (!same(_previous.pipes[retired + i], snapshot.pipes[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SpectatorEncoder::writeKeyframe(const GameSnapshot &snapshot)
+{
+    _forceKeyframe = false;
+    _ticksSinceKeyframe = 0;
+    _birdX = quantize(snapshot.birdX);
+    _birdY = quantize(snapshot.birdY);
+    _record.push_back(FLAG_KEYFRAME);
+    Varint::write(_record, snapshot.tick);
+    Varint::writeSigned(_record, _birdX);
+    Varint::writeSigned(_record, _birdY);
+    Varint::write(_record, snapshot.score);
+    _record.push_back((snapshot.birdDead ? STATE_BIRD_DEAD : 0) | (snapshot.gameOver ? STATE_GAME_OVER : 0));
+    Varint::write(_record, snapshot.pipeCount);
+    for (std::uint32_t i = 0; i < snapshot.pipeCount; i++) {
+        writePipe(snapshot.pipes[i]);
+    }
+}
+
+void SpectatorEncoder::writePipe(const PipeSnapshot &pipe)
+{
+    Varint::writeSigned(_record, quantize(pipe.x));
+    Varint::writeSigned(_record, quantize(pipe.gapCentre));
+    Varint::write(_record, static_cast<std::uint32_t>(quantize(pipe.gapHeight)));
+}
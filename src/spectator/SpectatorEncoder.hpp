@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorEncoder.hpp
+*/
+
+#ifndef STELLARFORGE_SPECTATORENCODER_HPP
+#define STELLARFORGE_SPECTATORENCODER_HPP
+
+#include <vector>
+#include "src/state/GameSnapshot.hpp"
+
+/**
+ * @class SpectatorEncoder
+ * @brief Turns one snapshot per tick into spectator stream records.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SpectatorEncoder {
+public:
+    /**
+     * @brief Constructor for the SpectatorEncoder class.
+     * @param tickRate Ticks per second the snapshots are taken at.
+     * @param keyframeInterval Ticks between two keyframes.
+     * @param pipeSpeed Horizontal speed of the pipes, in pixels per second.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    SpectatorEncoder(std::uint32_t tickRate, std::uint32_t keyframeInterval, float pipeSpeed);
+
+    /**
+     * @brief Appends the stream header.
+     * @param out Destination buffer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void writeHeader(std::vector<std::uint8_t> &out) const;
+
+    /**
+     * @brief Appends the record of one tick.
+     * @param snapshot State of the tick.
+     * @param out Destination buffer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void encode(const GameSnapshot &snapshot, std::vector<std::uint8_t> &out);
+
+    /**
+     * @brief Makes the next record a keyframe, e.g. after the stream lost data.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void requestKeyframe() { _forceKeyframe = true; }
+
+private:
+    [[nodiscard]] bool diffPipes(const GameSnapshot &snapshot, std::uint32_t &retired) const;
+    void writeKeyframe(const GameSnapshot &snapshot);
+    void writePipe(const PipeSnapshot &pipe);
+
+    std::uint32_t _tickRate; ///< Ticks per second
+    std::uint32_t _keyframeInterval; ///< Ticks between two keyframes
+    float _pipeSpeed; ///< Horizontal speed of the pipes
+    bool _forceKeyframe = true; ///< Next record must be a keyframe
+    std::uint32_t _ticksSinceKeyframe = 0; ///< Records written since the last keyframe
+    std::int32_t _birdX = 0; ///< Last sent quantized bird position
+    std::int32_t _birdY = 0; ///< Last sent quantized bird position
+    GameSnapshot _previous; ///< Snapshot of the previous tick
+    std::vector<std::uint8_t> _record; ///< Reused record buffer
+};
+
+#endif // STELLARFORGE_SPECTATORENCODER_HPP
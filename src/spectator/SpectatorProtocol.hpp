@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorProtocol.hpp
+*/
+
+#ifndef STELLARFORGE_SPECTATORPROTOCOL_HPP
+#define STELLARFORGE_SPECTATORPROTOCOL_HPP
+
+#include <cstdint>
+
+/**
+ * @namespace SpectatorProtocol
+ * @brief Layout of the spectator stream.
+ *
+ * The stream starts with a header (magic, version, tick rate, keyframe
+ * interval, pipe speed), followed by one record per tick. A record is a
+ * varint length, a flag byte and the fields selected by the flags, in flag
+ * order. Positions are quantized to a quarter pixel and written as zigzag
+ * varints, relative to the previous tick except in keyframes. Pipe pairs
+ * (left edge, gap centre, gap height) are only sent when they spawn, the
+ * viewer moves them at the pipe speed in between.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+namespace SpectatorProtocol {
+    constexpr std::uint8_t MAGIC[4] = {'F', 'B', 'S', 'P'}; ///< First bytes of a stream
+    constexpr std::uint8_t VERSION = 2; ///< Stream format version
+    constexpr float QUANTIZATION = 4; ///< Quantization steps per pixel
+
+    constexpr std::uint8_t FLAG_KEYFRAME = 1 << 0; ///< Absolute state: tick, bird, score, state bits, all pipes
+    constexpr std::uint8_t FLAG_BIRD_MOVED = 1 << 1; ///< Bird vertical position delta
+    constexpr std::uint8_t FLAG_SCORE = 1 << 2; ///< New score
+    constexpr std::uint8_t FLAG_PIPES_RETIRED = 1 << 3; ///< Number of pipes removed from the front of the list
+    constexpr std::uint8_t FLAG_PIPES_SPAWNED = 1 << 4; ///< Pipes appended to the list
+    constexpr std::uint8_t FLAG_BIRD_DIED = 1 << 5; ///< The bird_died event fired on this tick
+    constexpr std::uint8_t FLAG_BIRD_SHIFTED = 1 << 6; ///< Bird horizontal position delta, rare
+
+    constexpr std::uint8_t STATE_BIRD_DEAD = 1 << 0; ///< Keyframe state bit: the bird is dead
+    constexpr std::uint8_t STATE_GAME_OVER = 1 << 1; ///< Keyframe state bit: the game is over
+
+    /**
+     * @brief Quantizes a position.
+     * @param value Position in pixels.
+     * @return Quantized position.
+     */
+    inline std::int32_t quantize(const float value)
+    {
+        const float scaled = value * QUANTIZATION;
+        return static_cast<std::int32_t>(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+    }
+
+    /**
+     * @brief Reverts quantize.
+     * @param value Quantized position.
+     * @return Position in pixels.
+     */
+    inline float dequantize(const std::int32_t value)
+    {
+        return static_cast<float>(value) / QUANTIZATION;
+    }
+}
+
+#endif // STELLARFORGE_SPECTATORPROTOCOL_HPP
@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorSink.cpp
+*/
+
+#include "SpectatorSink.hpp"
+#include <stdexcept>
+#ifndef _WIN32
+ #include <cerrno>
+ #include <cstring>
+ #include <fcntl.h>
+ #include <sys/socket.h>
+ #include <sys/un.h>
+ #include <unistd.h>
+#endif // _WIN32
+
+namespace {
+    const std::string UNIX_PREFIX = "unix:";
+}
+
+SpectatorSink::SpectatorSink(const std::string &target)
+{
+    if (target.rfind(UNIX_PREFIX, 0) == 0) {
+#ifdef _WIN32
+        throw std::runtime_error("SpectatorSink: Unix sockets are not supported on this platform");
+#else
+        const std::string path = target.substr(UNIX_PREFIX.size());
+        sockaddr_un address {};
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("SpectatorSink: socket path too long: " + path);
+        }
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        _socket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (_socket < 0 || connect(_socket, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+            close(_socket);
+            throw std::runtime_error("SpectatorSink: cannot connect to " + path);
+        }
+        fcntl(_socket, F_SETFL, fcntl(_socket, F_GETFL, 0) | O_NONBLOCK);
+#endif // _WIN32
+    } else {
+        _file = std::fopen(target.c_str(), "wb");
+        if (_file == nullptr) {
+            throw std::runtime_error("SpectatorSink: cannot open " + target);
+        }
+    }
+    _backlog.reserve(4096);
+}
+
+SpectatorSink::~SpectatorSink()
+{
+    closeDestination();
+}
+
+void SpectatorSink::closeDestination()
+{
+    if (_file != nullptr) {
+        std::fclose(_file);
+        _file = nullptr;
+    }
+#ifndef _WIN32
+    if (_socket >= 0) {
+        close(_socket);
+        _socket = -1;
+    }
+#endif // _WIN32
+}
+
+bool SpectatorSink::write(const std::uint8_t *data, const std::size_t size)
+{
+    if (_file != nullptr) {
+        if (std::fwrite(data, 1, size, _file) != size || std::fflush(_file) != 0) {
+            closeDestination();
+            return false;
+        }
+        _written += size;
+        return true;
+    }
+    if (_socket < 0) {
+        return false;
+    }
+    if (_backlog.size() + size > MAX_BACKLOG) {
+        closeDestination();
+        return false;
+    }
+    _backlog.insert(_backlog.end(), data, data + size);
+    return flush();
+}
+
+bool SpectatorSink::flush()
+{
+#ifndef _WIN32
+    std::size_t offset = 0;
+    while (offset < _backlog.size()) {
+        const ssize_t written = send(_socket, _backlog.data() + offset, _backlog.size() - offset, MSG_NOSIGNAL);
+        if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            break;
+        }
+        if (written <= 0) {
+            closeDestination();
+            return false;
+        }
+        offset += static_cast<std::size_t>(written);
+    }
+    _written += offset;
+    _backlog.erase(_backlog.begin(), _backlog.begin() + static_cast<std::ptrdiff_t>(offset));
+#endif // _WIN32
+    return true;
+}
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SpectatorSink.hpp
+*/
+
+#ifndef STELLARFORGE_SPECTATORSINK_HPP
+#define STELLARFORGE_SPECTATORSINK_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @class SpectatorSink
+ * @brief Destination of a spectator stream: a file or a Unix socket.
+ *
+ * Socket writes never block the game loop. Bytes the socket cannot take
+ * yet are kept and retried on the next write; a viewer too slow to drain
+ * the backlog is disconnected. Unix sockets are not available on Windows.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SpectatorSink {
+public:
+    static constexpr std::size_t MAX_BACKLOG = 1 << 20; ///< Unsent bytes tolerated before giving up
+
+    /**
+     * @brief Opens the destination.
+     * @param target Path of a file, or "unix:<path>" to connect to a listening Unix socket.
+     * @throws std::runtime_error if the destination cannot be opened.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit SpectatorSink(const std::string &target);
+
+    /**
+     * @brief Closes the destination.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~SpectatorSink();
+
+    SpectatorSink(const SpectatorSink &) = delete;
+    SpectatorSink &operator=(const SpectatorSink &) = delete;
+
+    /**
+     * @brief Writes bytes, or queues them if the destination is busy.
+     * @param data Bytes to write.
+     * @param size Number of bytes to write.
+     * @return False once the destination is closed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool write(const std::uint8_t *data, std::size_t size);
+
+    /**
+     * @brief Gets the number of bytes written so far.
+     * @return The number of bytes written.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint64_t getBytesWritten() const { return _written; }
+
+private:
+    bool flush();
+    void closeDestination();
+
+    std::FILE *_file = nullptr; ///< Destination file, null if none or closed
+    int _socket = -1; ///< Destination socket, -1 if none or closed
+    std::vector<std::uint8_t> _backlog; ///< Bytes not accepted yet
+    std::uint64_t _written = 0; ///< Bytes written so far
+};
+
+#endif // STELLARFORGE_SPECTATORSINK_HPP
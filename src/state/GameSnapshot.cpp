@@ -0,0 +1,105 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameSnapshot.cpp
+*/
+
+#include "GameSnapshot.hpp"
+#include <cstring>
+
+namespace {
+    constexpr std::uint8_t SNAPSHOT_VERSION = 5;
+    constexpr std::uint8_t FLAG_BIRD_DEAD = 1 << 0;
+    constexpr std::uint8_t FLAG_GAME_OVER = 1 << 1;
+
+    template <typename T>
+    void put(std::uint8_t *&cursor, const T value)
+    {
+        std::memcpy(cursor, &value, sizeof(T));
+        cursor += sizeof(T);
+    }
+
+    template <typename T>
+    T get(const std::uint8_t *&cursor)
+    {
+        T value;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+    constexpr std::size_t encodedSize(const std::size_t pipeCount)
+    {
+        return 63 + pipeCount * 12;
+    }
+}
+
+std::size_t encodeSnapshot(const GameSnapshot &snapshot, std::uint8_t *out, const std::size_t capacity)
+{
+    const std::size_t size = encodedSize(snapshot.pipeCount);
+    if (capacity < size || snapshot.pipeCount > GameSnapshot::MAX_PIPES) {
+        return 0;
+    }
+    std::uint8_t *cursor = out;
+    put<std::uint8_t>(cursor, SNAPSHOT_VERSION);
+    put(cursor, snapshot.tick);
+    put(cursor, snapshot.birdX);
+    put(cursor, snapshot.birdY);
+    put(cursor, snapshot.birdVelocityX);
+    put(cursor, snapshot.birdVelocityY);
+    put(cursor, snapshot.birdAccelerationY);
+    put(cursor, snapshot.birdTerminalVelocity);
+    put<std::uint8_t>(cursor, (snapshot.birdDead ? FLAG_BIRD_DEAD : 0) | (snapshot.gameOver ? FLAG_GAME_OVER : 0));
+    put(cursor, snapshot.score);
+    put(cursor, snapshot.scoreTimer);
+    put(cursor, snapshot.scoreDelay);
+    put(cursor, snapshot.pipeTimer);
+    put(cursor, snapshot.pipeSpeed);
+    put(cursor, snapshot.pipeGap);
+    put(cursor, snapshot.rngState);
+    put(cursor, snapshot.backgroundX);
+    put(cursor, snapshot.pipeCount);
+    for (std::size_t i = 0; i < snapshot.pipeCount; i++) {
+        put(cursor, snapshot.pipes[i].x);
+        put(cursor, snapshot.pipes[i].gapCentre);
+        put(cursor, snapshot.pipes[i].gapHeight);
+    }
+    return size;
+}
+
+bool decodeSnapshot(const std::uint8_t *data, const std::size_t size, GameSnapshot &snapshot)
+{
+    if (size < encodedSize(0) || data[0] != SNAPSHOT_VERSION) {
+        return false;
+    }
+    const std::uint8_t *cursor = data + 1;
+    snapshot.tick = get<std::uint32_t>(cursor);
+    snapshot.birdX = get<float>(cursor);
+    snapshot.birdY = get<float>(cursor);
+    snapshot.birdVelocityX = get<float>(cursor);
+    snapshot.birdVelocityY = get<float>(cursor);
+    snapshot.birdAccelerationY = get<float>(cursor);
+    snapshot.birdTerminalVelocity = get<float>(cursor);
+    const auto flags = get<std::uint8_t>(cursor);
+    snapshot.birdDead = (flags & FLAG_BIRD_DEAD) != 0;
+    snapshot.gameOver = (flags & FLAG_GAME_OVER) != 0;
+    snapshot.score = get<std::uint32_t>(cursor);
+    snapshot.scoreTimer = get<float>(cursor);
+    snapshot.scoreDelay = get<float>(cursor);
+    snapshot.pipeTimer = get<float>(cursor);
+    snapshot.pipeSpeed = get<float>(cursor);
+    snapshot.pipeGap = get<float>(cursor);
+    snapshot.rngState = get<std::uint32_t>(cursor);
+    snapshot.backgroundX = get<float>(cursor);
+    snapshot.pipeCount = get<std::uint8_t>(cursor);
+    if (snapshot.pipeCount > GameSnapshot::MAX_PIPES || size < encodedSize(snapshot.pipeCount)) {
+        return false;
+    }
+    for (std::size_t i = 0; i < snapshot.pipeCount; i++) {
+        snapshot.pipes[i].x = get<float>(cursor);
+        snapshot.pipes[i].gapCentre = get<float>(cursor);
+        snapshot.pipes[i].gapHeight = get<float>(cursor);
+    }
+    return true;
+}
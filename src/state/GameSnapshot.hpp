@@ -0,0 +1,117 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameSnapshot.hpp
+*/
+
+#ifndef STELLARFORGE_GAMESNAPSHOT_HPP
+#define STELLARFORGE_GAMESNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "src/sim/GameRules.hpp"
+
+/**
+ * @struct PipeSnapshot
+ * @brief State of one live pipe pair, a column of pipe with a gap to fly through.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct PipeSnapshot {
+    float x = 0; ///< Left edge of the pair
+    float gapCentre = 0; ///< Vertical centre of the gap
+    float gapHeight = 0; ///< Height of the gap
+
+    /**
+     * @brief Gets the bottom edge of the top pipe.
+     * @return Height of the top of the gap.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float gapTop() const { return gapCentre - gapHeight / 2; }
+
+    /**
+     * @brief Gets the top edge of the bottom pipe.
+     * @return Height of the bottom of the gap.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float gapBottom() const { return gapCentre + gapHeight / 2; }
+};
+
+/**
+ * @struct GameSnapshot
+ * @brief Plain copy of the whole play state for one tick.
+ *
+ * Fixed size so it can be taken every tick without allocating.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct GameSnapshot {
+    static constexpr std::size_t MAX_PIPES = 16; ///< Upper bound on live pipe pairs
+
+    std::uint32_t tick = 0; ///< Tick the snapshot was taken on
+
+    float birdX = 0; ///< Bird horizontal position
+    float birdY = 0; ///< Bird vertical position
+    float birdVelocityX = 0; ///< Bird horizontal velocity
+    float birdVelocityY = 0; ///< Bird vertical velocity
+    float birdAccelerationY = 0; ///< Bird vertical acceleration
+    float birdTerminalVelocity = 0; ///< Bird terminal velocity
+    bool birdDead = false; ///< Bird died on this tick or before
+
+    std::uint32_t score = 0; ///< Current score
+    float scoreTimer = 0; ///< Seconds since the last score increment
+    float scoreDelay = 0; ///< Seconds required for the next score increment
+
+    float pipeTimer = 0; ///< Seconds since the last pipe spawn
+    float pipeSpeed = GameRules::PIPE_SPEED; ///< Horizontal speed of the pipes, the one every pipe and collision test uses
+    float pipeGap = GameRules::PIPE_GAP; ///< Gap height of the pairs spawned from now on
+    std::uint32_t rngState = 0; ///< State of the pipe course generator
+
+    float backgroundX = 0; ///< Background scroll position
+
+    bool gameOver = false; ///< Game-over flag
+
+    std::uint8_t pipeCount = 0; ///< Number of valid entries in pipes
+    PipeSnapshot pipes[MAX_PIPES]; ///< Live pipe pairs, oldest first
+};
+
+/**
+ * @brief Largest buffer encodeSnapshot can ever need.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+constexpr std::size_t SNAPSHOT_MAX_ENCODED_SIZE = 64 + GameSnapshot::MAX_PIPES * 12;
+
+/**
+ * @brief Writes a snapshot in the compact binary format.
+ * @param snapshot Snapshot to encode.
+ * @param out Destination buffer.
+ * @param capacity Size of the destination buffer.
+ * @return Number of bytes written, 0 if the buffer is too small.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+std::size_t encodeSnapshot(const GameSnapshot &snapshot, std::uint8_t *out, std::size_t capacity);
+
+/**
+ * @brief Reads a snapshot written by encodeSnapshot.
+ * @param data Encoded bytes.
+ * @param size Number of encoded bytes.
+ * @param snapshot Snapshot to fill.
+ * @return True if the buffer held a valid snapshot.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+bool decodeSnapshot(const std::uint8_t *data, std::size_t size, GameSnapshot &snapshot);
+
+#endif // STELLARFORGE_GAMESNAPSHOT_HPP
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameState.cpp
+*/
+
+#include "GameState.hpp"
+#include <algorithm>
+
+GameState::GameState()
+    : _history(HISTORY_TICKS)
+{
+}
+
+GameState &GameState::getInstance()
+{
+    static GameState instance;
+    return instance;
+}
+
+void GameState::registerParticipant(ISnapshotable *participant)
+{
+    if (std::find(_participants.begin(), _participants.end(), participant) == _participants.end()) {
+        _participants.push_back(participant);
+    }
+}
+
+void GameState::unregisterParticipant(ISnapshotable *participant)
+{
+    _participants.erase(std::remove(_participants.begin(), _participants.end(), participant), _participants.end());
+}
+
+void GameState::capture(GameSnapshot &snapshot) const
+{
+    snapshot.tick = _tick;
+    snapshot.pipeCount = 0;
+    for (auto *participant : _participants) {
+        participant->saveState(snapshot);
+    }
+}
+
+void GameState::restore(const GameSnapshot &snapshot)
+{
+    for (auto *participant : _participants) {
+        participant->loadState(snapshot);
+    }
+    _tick = snapshot.tick;
+}
+
+void GameState::recordTick(const std::uint32_t steps)
+{
+    _tick += steps;
+    capture(_scratch);
+    // No pipe spawns on the first tick, so its generator state still describes the whole course.
+    if (_tick == steps) {
+        _courseSeed = _scratch.rngState;
+    }
+    _history.push(_scratch);
+}
+
+bool GameState::rewind(const std::size_t ticks)
+{
+    const GameSnapshot *latest = _history.at(0);
+    if (latest == nullptr) {
+        return false;
+    }
+    // Frames that ran several steps leave gaps between ticks, so walk back by tick rather than by entry.
+    std::size_t entries = 0;
+    for (const GameSnapshot *older = _history.at(1); older != nullptr && latest->tick - older->tick <= ticks; older = _history.at(entries + 1)) {
+        entries++;
+    }
+    const GameSnapshot *snapshot = _history.rewind(entries);
+    restore(*snapshot);
+    return true;
+}
+
+void GameState::reset()
+{
+    for (auto *participant : _participants) {
+        participant->resetState();
+    }
+    _tick = 0;
+    _history.clear();
+}
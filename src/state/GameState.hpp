@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** GameState.hpp
+*/
+
+#ifndef STELLARFORGE_GAMESTATE_HPP
+#define STELLARFORGE_GAMESTATE_HPP
+
+#include <vector>
+#include "ISnapshotable.hpp"
+#include "SnapshotHistory.hpp"
+
+/**
+ * @class GameState
+ * @brief Captures and restores the play state of every registered component.
+ *
+ * Keeps one snapshot per simulated frame in a ring so the game can be
+ * rewound by any number of ticks still in the history.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class GameState {
+public:
+    static constexpr std::size_t HISTORY_TICKS = 600; ///< Ticks kept in the history (10 s at 60 Hz)
+
+    /**
+     * @brief Gets the GameState instance.
+     * @return The GameState instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static GameState &getInstance();
+
+    GameState(const GameState &) = delete;
+    GameState &operator=(const GameState &) = delete;
+
+    /**
+     * @brief Adds a component to the captured state.
+     * @param participant Component owning part of the play state.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void registerParticipant(ISnapshotable *participant);
+
+    /**
+     * @brief Removes a component from the captured state.
+     * @param participant Component to remove.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void unregisterParticipant(ISnapshotable *participant);
+
+    /**
+     * @brief Copies the current play state into a snapshot.
+     * @param snapshot Snapshot to fill.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void capture(GameSnapshot &snapshot) const;
+
+    /**
+     * @brief Puts every registered component back in the state of a snapshot.
+     * @param snapshot Snapshot to restore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void restore(const GameSnapshot &snapshot);
+
+    /**
+     * @brief Advances the tick counter and captures the new tick into the history.
+     * @param steps Simulation steps run since the previous record.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void recordTick(std::uint32_t steps = 1);
+
+    /**
+     * @brief Restores the state recorded a number of ticks ago.
+     * @param ticks Number of ticks to go back, clamped to the oldest recorded tick.
+     * @return False if nothing was recorded yet.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool rewind(std::size_t ticks);
+
+    /**
+     * @brief Starts a new game in place, without reloading the scene.
+     *
+     * Resets every registered component, the tick counter and the history.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void reset();
+
+    /**
+     * @brief Gets the recorded snapshots.
+     * @return The snapshot history.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const SnapshotHistory &getHistory() const { return _history; }
+
+    /**
+     * @brief Gets the current tick.
+     * @return The current tick.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getTick() const { return _tick; }
+
+    /**
+     * @brief Gets the state of the pipe course generator when the game started.
+     * @return The generator state of the first tick recorded since the last reset.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getCourseSeed() const { return _courseSeed; }
+
+private:
+    GameState();
+
+    std::vector<ISnapshotable *> _participants; ///< Components owning the play state
+    SnapshotHistory _history; ///< Last recorded ticks
+    GameSnapshot _scratch; ///< Reused capture buffer
+    std::uint32_t _tick = 0; ///< Current tick
+    std::uint32_t _courseSeed = 0; ///< Generator state at the start of the game
+};
+
+#endif // STELLARFORGE_GAMESTATE_HPP
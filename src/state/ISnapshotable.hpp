@@ -0,0 +1,51 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ISnapshotable.hpp
+*/
+
+#ifndef STELLARFORGE_ISNAPSHOTABLE_HPP
+#define STELLARFORGE_ISNAPSHOTABLE_HPP
+
+#include "GameSnapshot.hpp"
+
+/**
+ * @interface ISnapshotable
+ * @brief Implemented by the gameplay components owning a part of the play state.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class ISnapshotable {
+public:
+    virtual ~ISnapshotable() = default;
+
+    /**
+     * @brief Copies the component's part of the play state into a snapshot.
+     * @param snapshot Snapshot to fill.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    virtual void saveState(GameSnapshot &snapshot) = 0;
+
+    /**
+     * @brief Puts the component back in the state recorded in a snapshot.
+     * @param snapshot Snapshot to restore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    virtual void loadState(const GameSnapshot &snapshot) = 0;
+
+    /**
+     * @brief Puts the component back in the state of a new game.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    virtual void resetState() = 0;
+};
+
+#endif // STELLARFORGE_ISNAPSHOTABLE_HPP
@@ -0,0 +1,62 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SnapshotHistory.cpp
+*/
+
+#include "SnapshotHistory.hpp"
+
+SnapshotHistory::SnapshotHistory(const std::size_t capacity)
+    : _ring(capacity > 0 ? capacity : 1)
+{
+}
+
+void SnapshotHistory::push(const GameSnapshot &snapshot)
+{
+    _ring[_head] = snapshot;
+    _head = (_head + 1) % _ring.size();
+    if (_size < _ring.size()) {
+        _size++;
+    }
+}
+
+const GameSnapshot *SnapshotHistory::at(const std::size_t ticksAgo) const
+{
+    if (ticksAgo >= _size) {
+        return nullptr;
+    }
+    return &_ring[(_head + _ring.size() - 1 - ticksAgo) % _ring.size()];
+}
+
+const GameSnapshot *SnapshotHistory::find(const std::uint32_t tick) const
+{
+    const GameSnapshot *latest = at(0);
+    if (latest == nullptr || tick > latest->tick) {
+        return nullptr;
+    }
+    const GameSnapshot *snapshot = at(latest->tick - tick);
+    if (snapshot == nullptr || snapshot->tick != tick) {
+        return nullptr;
+    }
+    return snapshot;
+}
+
+const GameSnapshot *SnapshotHistory::rewind(std::size_t ticks)
+{
+    if (_size == 0) {
+        return nullptr;
+    }
+    if (ticks >= _size) {
+        ticks = _size - 1;
+    }
+    _head = (_head + _ring.size() - ticks) % _ring.size();
+    _size -= ticks;
+    return at(0);
+}
+
+void SnapshotHistory::clear()
+{
+    _head = 0;
+    _size = 0;
+}
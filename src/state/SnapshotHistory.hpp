@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** SnapshotHistory.hpp
+*/
+
+#ifndef STELLARFORGE_SNAPSHOTHISTORY_HPP
+#define STELLARFORGE_SNAPSHOTHISTORY_HPP
+
+#include <vector>
+#include "GameSnapshot.hpp"
+
+/**
+ * @class SnapshotHistory
+ * @brief Fixed-capacity ring of the most recent snapshots, one per tick.
+ *
+ * The storage is allocated once at construction, pushing a snapshot is a
+ * plain copy and never allocates.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class SnapshotHistory {
+public:
+    /**
+     * @brief Constructor for the SnapshotHistory class.
+     * @param capacity Number of ticks kept.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit SnapshotHistory(std::size_t capacity);
+
+    /**
+     * @brief Records a snapshot, dropping the oldest one when full.
+     * @param snapshot Snapshot to record.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void push(const GameSnapshot &snapshot);
+
+    /**
+     * @brief Gets a recorded snapshot.
+     * @param ticksAgo 0 for the latest snapshot, 1 for the one before, and so on.
+     * @return The snapshot, or nullptr if it is not in the history anymore.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const GameSnapshot *at(std::size_t ticksAgo) const;
+
+    /**
+     * @brief Finds the snapshot taken on a given tick.
+     * @param tick Tick to look for.
+     * @return The snapshot, or nullptr if it is not in the history.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const GameSnapshot *find(std::uint32_t tick) const;
+
+    /**
+     * @brief Drops the most recent snapshots.
+     * @param ticks Number of ticks to go back, clamped to the oldest snapshot.
+     * @return The snapshot that is now the latest one, or nullptr if the history is empty.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    const GameSnapshot *rewind(std::size_t ticks);
+
+    /**
+     * @brief Removes every snapshot.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of recorded snapshots.
+     * @return The number of recorded snapshots.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return _size; }
+
+    /**
+     * @brief Gets the number of snapshots the history can hold.
+     * @return The capacity of the history.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t capacity() const { return _ring.size(); }
+
+private:
+    std::vector<GameSnapshot> _ring; ///< Snapshot storage
+    std::size_t _head = 0; ///< Index the next snapshot is written to
+    std::size_t _size = 0; ///< Number of valid snapshots
+};
+
+#endif // STELLARFORGE_SNAPSHOTHISTORY_HPP
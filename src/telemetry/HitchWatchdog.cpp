@@ -0,0 +1,268 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** HitchWatchdog.cpp
+*/
+
+#include "HitchWatchdog.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include "src/audit/AllocationAudit.hpp"
+#if defined(__GLIBC__)
+ #include <malloc.h>
+#endif // __GLIBC__
+
+namespace {
+    std::string directoryFromEnvironment()
+    {
+        const char *directory = std::getenv("FLAPPY_HITCH_DIR");
+        if (directory == nullptr || *directory == '\0') {
+            return HitchWatchdog::DEFAULT_DIRECTORY;
+        }
+        return std::string(directory) == "off" ? std::string() : std::string(directory);
+    }
+
+    std::int64_t steadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    const char *eventName(const HitchEvent event)
+    {
+        switch (event) {
+            case HitchEvent::JUMP:
+                return "jump";
+            case HitchEvent::BIRD_DIED:
+                return "bird_died";
+            case HitchEvent::PIPE_SPAWNED:
+                return "pipe_spawned";
+            case HitchEvent::PIPE_RETIRED:
+                return "pipe_retired";
+            default:
+                return "unknown";
+        }
+    }
+
+    // Bytes the allocator currently hands out, -1 where the C library cannot tell cheaply.
+    std::int64_t heapInUse()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        const struct mallinfo2 info = mallinfo2();
+        return static_cast<std::int64_t>(info.uordblks + info.hblkhd);
+#else
+        return -1;
+#endif
+    }
+}
+
+HitchWatchdog::Section::Section(const char *name)
+    : _name(name), _started(steadyNanoseconds())
+{
+}
+
+HitchWatchdog::Section::~Section()
+{
+    HitchWatchdog::getInstance().addSection(_name, steadyNanoseconds() - _started);
+}
+
+HitchWatchdog &HitchWatchdog::getInstance()
+{
+    static HitchWatchdog instance(directoryFromEnvironment(), DEFAULT_BUDGET);
+    return instance;
+}
+
+HitchWatchdog::HitchWatchdog(std::string directory, const float budget)
+    : _directory(std::move(directory)), _budget(budget), _started(steadyNanoseconds())
+{
+    if (!_directory.empty()) {
+        _writer = std::thread(&HitchWatchdog::work, this);
+    }
+}
+
+HitchWatchdog::~HitchWatchdog()
+{
+    if (!_writer.joinable()) {
+        return;
+    }
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_one();
+    _writer.join();
+}
+
+void HitchWatchdog::addSection(const char *name, const std::int64_t nanoseconds)
+{
+    for (auto &slot : _sections) {
+        if (slot.name == nullptr) {
+            slot.name = name;
+        }
+        if (slot.name == name) {
+            slot.nanoseconds += nanoseconds;
+            slot.calls++;
+            return;
+        }
+    }
+}
+
+void HitchWatchdog::recordEvent(const HitchEvent event)
+{
+    _events[_eventCount % EVENT_HISTORY] = {event, _frame, steadyNanoseconds()};
+    _eventCount++;
+}
+
+bool HitchWatchdog::endFrame(const float frameTime, const std::uint64_t tick)
+{
+    std::int64_t allocations = -1;
+#ifdef FLAPPY_ALLOCATION_AUDIT
+    const std::uint64_t allocated = AllocationAudit::allocations();
+    allocations = static_cast<std::int64_t>(allocated - _allocations);
+    _allocations = allocated;
+#endif // FLAPPY_ALLOCATION_AUDIT
+    const bool hitch = frameTime > _budget;
+    _stats.frames++;
+    if (hitch) {
+        _stats.hitches++;
+        const std::int64_t now = steadyNanoseconds();
+        bool slotFree = false;
+        if (!_directory.empty()) {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            slotFree = _captured - _written < REPORT_RING;
+        }
+        // The cooldown bounds the disk traffic of a long stutter, the skipped hitches are only counted.
+        if (!slotFree || (_stats.reports > 0 && static_cast<double>(now - _lastReport) / 1e9 < REPORT_COOLDOWN)) {
+            _stats.suppressed++;
+            _suppressedSinceReport++;
+        } else {
+            capture(_captures[_stats.reports % REPORT_RING], frameTime, tick, allocations, now);
+            _lastReport = now;
+            _suppressedSinceReport = 0;
+        }
+    }
+    for (auto &slot : _sections) {
+        slot.nanoseconds = 0;
+        slot.calls = 0;
+    }
+    _objects.fill(0);
+    _frame++;
+    return hitch;
+}
+
+void HitchWatchdog::capture(FrameCapture &capture, const float frameTime, const std::uint64_t tick, const std::int64_t allocations, const std::int64_t now)
+{
+    capture.report = _stats.reports;
+    capture.frame = _frame;
+    capture.tick = tick;
+    capture.frameTime = frameTime;
+    capture.budget = _budget;
+    capture.uptime = now - _started;
+    capture.now = now;
+    capture.allocations = allocations;
+    capture.heap = heapInUse();
+    capture.suppressedBefore = _suppressedSinceReport;
+    capture.sections = _sections;
+    capture.objects = _objects;
+    capture.events = _events;
+    capture.eventCount = _eventCount;
+    _stats.reports++;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        _captured++;
+    }
+    _wake.notify_one();
+}
+
+std::string HitchWatchdog::formatReport(const FrameCapture &capture)
+{
+    std::vector<SectionTime> sections;
+    for (const auto &slot : capture.sections) {
+        if (slot.name != nullptr && slot.calls > 0) {
+            sections.push_back(slot);
+        }
+    }
+    std::sort(sections.begin(), sections.end(), [](const SectionTime &a, const SectionTime &b) { return a.nanoseconds > b.nanoseconds; });
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"frame\":" << capture.frame << ",\"tick\":" << capture.tick
+        << ",\"uptime_s\":" << static_cast<double>(capture.uptime) / 1e9
+        << ",\"frame_time_ms\":" << capture.frameTime * 1000 << ",\"budget_ms\":" << capture.budget * 1000
+        << ",\"suppressed_before\":" << capture.suppressedBefore << ",\"sections\":[";
+    std::int64_t timed = 0;
+    for (std::size_t i = 0; i < sections.size(); i++) {
+        timed += sections[i].nanoseconds;
+        json << (i > 0 ? "," : "") << "{\"name\":\"" << sections[i].name << "\",\"ms\":" << static_cast<double>(sections[i].nanoseconds) / 1e6
+            << ",\"calls\":" << sections[i].calls << "}";
+    }
+    // What the sections do not cover was spent in the engine: physics, rendering, other objects or the OS.
+    json << "],\"untimed_ms\":" << std::max(0.0, static_cast<double>(capture.frameTime) * 1000 - static_cast<double>(timed) / 1e6)
+        << ",\"objects\":{\"lookups\":" << capture.objects[static_cast<std::size_t>(ObjectActivity::LOOKUP)]
+        << ",\"updates\":" << capture.objects[static_cast<std::size_t>(ObjectActivity::UPDATE)]
+        << ",\"duplicates\":" << capture.objects[static_cast<std::size_t>(ObjectActivity::DUPLICATE)] << "},\"allocations\":";
+    if (capture.allocations < 0) {
+        json << "null";
+    } else {
+        json << capture.allocations;
+    }
+    json << ",\"heap_in_use_bytes\":";
+    if (capture.heap < 0) {
+        json << "null";
+    } else {
+        json << capture.heap;
+    }
+    json << ",\"events\":[";
+    const std::uint64_t first = capture.eventCount > EVENT_HISTORY ? capture.eventCount - EVENT_HISTORY : 0;
+    for (std::uint64_t i = first; i < capture.eventCount; i++) {
+        const EventRecord &record = capture.events[i % EVENT_HISTORY];
+        json << (i > first ? "," : "") << "{\"event\":\"" << eventName(record.event) << "\",\"frame\":" << record.frame
+            << ",\"ms_ago\":" << static_cast<double>(capture.now - record.nanoseconds) / 1e6 << "}";
+    }
+    json << "]}\n";
+    return json.str();
+}
+
+void HitchWatchdog::work()
+{
+    for (;;) {
+        std::uint64_t next = 0;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [this]() { return _stopping || _written < _captured; });
+            if (_written == _captured) {
+                return;
+            }
+            next = _written;
+        }
+        // The game thread does not touch this slot again until _written moves past it.
+        const FrameCapture &capture = _captures[next % REPORT_RING];
+        char name[32];
+        std::snprintf(name, sizeof(name), "hitch_%02llu.json", static_cast<unsigned long long>(capture.report % REPORT_RING));
+        const std::filesystem::path path = std::filesystem::path(_directory) / name;
+        const std::string report = formatReport(capture);
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            _written++;
+        }
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+        // Written aside and renamed, a crash while writing never leaves half a report in the ring.
+        const std::filesystem::path temporary = path.string() + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::trunc);
+            file << report;
+            if (!file) {
+                continue;
+            }
+        }
+        std::filesystem::rename(temporary, path, error);
+    }
+}
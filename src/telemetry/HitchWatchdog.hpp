@@ -0,0 +1,325 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** HitchWatchdog.hpp
+*/
+
+#ifndef STELLARFORGE_HITCHWATCHDOG_HPP
+#define STELLARFORGE_HITCHWATCHDOG_HPP
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @enum HitchEvent
+ * @brief Gameplay events kept in the watchdog history.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+enum class HitchEvent : std::uint8_t {
+    JUMP, ///< A jump key was pressed
+    BIRD_DIED, ///< The bird_died event was triggered
+    PIPE_SPAWNED, ///< A pipe pair was spawned
+    PIPE_RETIRED ///< A pipe pair left the screen
+};
+
+/**
+ * @enum ObjectActivity
+ * @brief ObjectManager calls counted per frame.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+enum class ObjectActivity : std::uint8_t {
+    LOOKUP, ///< getObjectById
+    UPDATE, ///< updateObject
+    DUPLICATE, ///< duplicateObject
+    COUNT ///< Number of activities
+};
+
+/**
+ * @struct HitchStats
+ * @brief What the watchdog saw since the game started.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+struct HitchStats {
+    std::uint64_t frames = 0; ///< Frames checked against the budget
+    std::uint64_t hitches = 0; ///< Frames over the budget
+    std::uint64_t reports = 0; ///< Hitch reports written
+    std::uint64_t suppressed = 0; ///< Hitches not written because of the cooldown
+};
+
+/**
+ * @class HitchWatchdog
+ * @brief Checks every frame time against a budget and writes a report for the frames over it.
+ *
+ * Components time their update with FRAME_SECTION and gameplay code records
+ * events and ObjectManager calls as they happen. Everything lands in fixed
+ * arrays, so a normal frame costs two clock reads per section and no
+ * allocation. When a frame is over budget the watchdog copies that frame's
+ * sections, object activity, allocations and the recent event history into
+ * one of REPORT_RING preallocated slots, so a hitch does not allocate
+ * either. A writer thread formats the slot and writes it to the matching
+ * file of the ring, overwriting the oldest. Reports are at least
+ * REPORT_COOLDOWN apart, so a long stutter costs one write per second, and a
+ * hitch while every slot still waits for the writer is only counted. The
+ * reports go to the hitches directory, which the FLAPPY_HITCH_DIR
+ * environment variable overrides; "off" only keeps the counts. Only the game
+ * thread may call it.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class HitchWatchdog {
+public:
+    static constexpr const char *DEFAULT_DIRECTORY = "telemetry/hitches"; ///< Default report location
+    static constexpr float DEFAULT_BUDGET = 1.0f / 30; ///< Two 60 Hz frames, in seconds
+    static constexpr std::size_t MAX_SECTIONS = 16; ///< Distinct section names timed
+    static constexpr std::size_t EVENT_HISTORY = 64; ///< Recent events kept
+    static constexpr std::size_t REPORT_RING = 16; ///< Report files kept on disk
+    static constexpr double REPORT_COOLDOWN = 1.0; ///< Seconds between two reports
+
+    /**
+     * @class Section
+     * @brief Adds the time it is alive to a named section of the current frame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    class Section {
+    public:
+        /**
+         * @brief Starts timing a section.
+         * @param name Name of the section, must outlive the program (a string literal).
+         * @version v0.2.0
+         * @since v0.2.0
+         * @author Landry Gigant
+         */
+        explicit Section(const char *name);
+
+        /**
+         * @brief Adds the elapsed time to the section.
+         * @version v0.2.0
+         * @since v0.2.0
+         * @author Landry Gigant
+         */
+        ~Section();
+
+        Section(const Section &) = delete;
+        Section &operator=(const Section &) = delete;
+
+    private:
+        const char *_name; ///< Section name
+        std::int64_t _started; ///< Steady clock time of the start in nanoseconds
+    };
+
+    /**
+     * @brief Gets the watchdog of the running game.
+     * @return The HitchWatchdog instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static HitchWatchdog &getInstance();
+
+    /**
+     * @brief Constructor for the HitchWatchdog class.
+     * @param directory Report directory, empty to only count the hitches.
+     * @param budget Longest acceptable frame time in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    HitchWatchdog(std::string directory, float budget);
+
+    /**
+     * @brief Writes the captured reports and stops the writer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~HitchWatchdog();
+
+    HitchWatchdog(const HitchWatchdog &) = delete;
+    HitchWatchdog &operator=(const HitchWatchdog &) = delete;
+
+    /**
+     * @brief Sets the frame-time budget.
+     * @param budget Longest acceptable frame time in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setBudget(float budget) { _budget = budget; }
+
+    /**
+     * @brief Gets the frame-time budget.
+     * @return The budget in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] float getBudget() const { return _budget; }
+
+    /**
+     * @brief Adds an event to the history.
+     * @param event What happened.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void recordEvent(HitchEvent event);
+
+    /**
+     * @brief Counts an ObjectManager call of the current frame.
+     * @param activity Kind of call.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void countObject(ObjectActivity activity) { _objects[static_cast<std::size_t>(activity)]++; }
+
+    /**
+     * @brief Checks the frame that just ended, reports it if over budget and starts the next one.
+     * @param frameTime Time between the last two presented frames in seconds.
+     * @param tick Simulation tick reached.
+     * @return True if the frame was over budget.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool endFrame(float frameTime, std::uint64_t tick);
+
+    /**
+     * @brief Gets what the watchdog saw so far.
+     * @return The hitch statistics.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] const HitchStats &getStats() const { return _stats; }
+
+private:
+    /**
+     * @struct SectionTime
+     * @brief Time spent in one section during the current frame.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct SectionTime {
+        const char *name = nullptr; ///< Section name, null while the slot is free
+        std::int64_t nanoseconds = 0; ///< Time spent this frame
+        std::uint32_t calls = 0; ///< Sections opened this frame
+    };
+
+    /**
+     * @struct EventRecord
+     * @brief An event of the history and when it happened.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct EventRecord {
+        HitchEvent event = HitchEvent::JUMP; ///< What happened
+        std::uint64_t frame = 0; ///< Frame it happened on
+        std::int64_t nanoseconds = 0; ///< Steady clock time it happened at
+    };
+
+    /**
+     * @struct FrameCapture
+     * @brief Raw data of an over-budget frame, waiting for the writer.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    struct FrameCapture {
+        std::uint64_t report = 0; ///< Report number, picks the file of the ring
+        std::uint64_t frame = 0; ///< Frame that was over budget
+        std::uint64_t tick = 0; ///< Simulation tick reached
+        float frameTime = 0; ///< Time of the frame in seconds
+        float budget = 0; ///< Budget when the frame ended in seconds
+        std::int64_t uptime = 0; ///< Nanoseconds since the watchdog creation
+        std::int64_t now = 0; ///< Steady clock time of the capture in nanoseconds
+        std::int64_t allocations = -1; ///< Allocations of the frame, negative if not counted
+        std::int64_t heap = -1; ///< Bytes in use on the heap, negative if unknown
+        std::uint64_t suppressedBefore = 0; ///< Hitches skipped since the previous report
+        std::array<SectionTime, MAX_SECTIONS> sections {}; ///< Section times of the frame
+        std::array<std::uint32_t, static_cast<std::size_t>(ObjectActivity::COUNT)> objects {}; ///< ObjectManager calls of the frame
+        std::array<EventRecord, EVENT_HISTORY> events {}; ///< Ring of recent events
+        std::uint64_t eventCount = 0; ///< Events recorded up to the capture
+    };
+
+    /**
+     * @brief Adds time to a section of the current frame.
+     * @param name Section name.
+     * @param nanoseconds Time spent.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void addSection(const char *name, std::int64_t nanoseconds);
+
+    /**
+     * @brief Copies the frame that just ended into the next slot and wakes the writer.
+     * @param capture Slot to fill, free until the writer is woken.
+     * @param frameTime Time of the frame in seconds.
+     * @param tick Simulation tick reached.
+     * @param allocations Allocations of the frame, negative if not counted.
+     * @param now Steady clock time in nanoseconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void capture(FrameCapture &capture, float frameTime, std::uint64_t tick, std::int64_t allocations, std::int64_t now);
+
+    /**
+     * @brief Formats a captured frame as a JSON report, on the writer thread.
+     * @param capture Captured frame.
+     * @return The report.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static std::string formatReport(const FrameCapture &capture);
+
+    /**
+     * @brief Writes the captured frames to the ring of files until stopped.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void work();
+
+    std::string _directory; ///< Report directory, empty to disable the reports
+    float _budget; ///< Longest acceptable frame time in seconds
+    std::array<SectionTime, MAX_SECTIONS> _sections {}; ///< Section times of the current frame
+    std::array<EventRecord, EVENT_HISTORY> _events {}; ///< Ring of recent events
+    std::uint64_t _eventCount = 0; ///< Events recorded since the start
+    std::array<std::uint32_t, static_cast<std::size_t>(ObjectActivity::COUNT)> _objects {}; ///< ObjectManager calls this frame
+    std::uint64_t _allocations = 0; ///< Allocation count at the start of the frame
+    std::uint64_t _frame = 0; ///< Frame being timed
+    std::int64_t _started = 0; ///< Steady clock time of the watchdog creation in nanoseconds
+    std::int64_t _lastReport = 0; ///< Steady clock time of the last report in nanoseconds
+    std::uint64_t _suppressedSinceReport = 0; ///< Hitches skipped since the last report
+    HitchStats _stats; ///< Counts since the start
+    std::array<FrameCapture, REPORT_RING> _captures {}; ///< Over-budget frames, one slot per report file
+    std::mutex _mutex; ///< Guards the counters below
+    std::condition_variable _wake; ///< Wakes the writer
+    std::uint64_t _captured = 0; ///< Frames copied into the slots
+    std::uint64_t _written = 0; ///< Captured frames the writer is done with
+    bool _stopping = false; ///< The destructor asked the writer to stop
+    std::thread _writer; ///< Formats and writes the reports, only started with a report directory
+};
+
+#define FRAME_SECTION(name) const HitchWatchdog::Section frameSection(name)
+
+#endif // STELLARFORGE_HITCHWATCHDOG_HPP
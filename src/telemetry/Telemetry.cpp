@@ -0,0 +1,245 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Telemetry.cpp
+*/
+
+#include "Telemetry.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+    std::string directoryFromEnvironment()
+    {
+        const char *directory = std::getenv("FLAPPY_TELEMETRY_DIR");
+        if (directory == nullptr || *directory == '\0') {
+            return Telemetry::DEFAULT_DIRECTORY;
+        }
+        return std::string(directory) == "off" ? std::string() : std::string(directory);
+    }
+
+    const char *causeName(const DeathCause cause)
+    {
+        switch (cause) {
+            case DeathCause::GROUND:
+                return "ground";
+            case DeathCause::CEILING:
+                return "ceiling";
+            case DeathCause::PIPE:
+                return "pipe";
+            default:
+                return "none";
+        }
+    }
+
+    std::int64_t steadyNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+Telemetry &Telemetry::getInstance()
+{
+    static Telemetry instance(directoryFromEnvironment());
+    return instance;
+}
+
+Telemetry::Telemetry(std::string directory)
+    : _directory(std::move(directory))
+{
+    beginSession();
+}
+
+void Telemetry::beginSession()
+{
+    _session++;
+    _startedAt = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    _startedSteady = steadyNanoseconds();
+    _exported = false;
+    for (auto &bucket : _frameBuckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    _frameNanoseconds.store(0, std::memory_order_relaxed);
+    _frameMaxNanoseconds.store(0, std::memory_order_relaxed);
+    _ticks.store(0, std::memory_order_relaxed);
+    _pipesSpawned.store(0, std::memory_order_relaxed);
+    _pipesRetired.store(0, std::memory_order_relaxed);
+    _score.store(0, std::memory_order_relaxed);
+    _deathCause.store(DeathCause::NONE, std::memory_order_relaxed);
+    _deathTick.store(-1, std::memory_order_relaxed);
+}
+
+void Telemetry::recordFrame(const float seconds)
+{
+    std::size_t bucket = 0;
+    while (bucket < BUCKET_BOUNDS.size() && seconds > BUCKET_BOUNDS[bucket]) {
+        bucket++;
+    }
+    _frameBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    const auto nanoseconds = static_cast<std::uint64_t>(static_cast<double>(seconds) * 1e9);
+    _frameNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    for (std::uint64_t max = _frameMaxNanoseconds.load(std::memory_order_relaxed);
+        nanoseconds > max && !_frameMaxNanoseconds.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed);) {
+    }
+}
+
+void Telemetry::recordDeath(const DeathCause cause)
+{
+    // Only the first death of a session counts, the bird keeps falling afterwards.
+    DeathCause expected = DeathCause::NONE;
+    if (_deathCause.compare_exchange_strong(expected, cause, std::memory_order_relaxed)) {
+        _deathTick.store(static_cast<std::int64_t>(_ticks.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+    }
+}
+
+double Telemetry::frameTimePercentile(const double quantile) const
+{
+    std::array<std::uint64_t, BUCKETS> counts {};
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < BUCKETS; i++) {
+        counts[i] = _frameBuckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    const double rank = quantile * static_cast<double>(total);
+    std::uint64_t below = 0;
+    for (std::size_t i = 0; i < BUCKETS; i++) {
+        if (counts[i] > 0 && static_cast<double>(below + counts[i]) >= rank) {
+            const double lower = i == 0 ? 0 : BUCKET_BOUNDS[i - 1];
+            const double upper = i < BUCKET_BOUNDS.size() ? BUCKET_BOUNDS[i]
+                : static_cast<double>(_frameMaxNanoseconds.load(std::memory_order_relaxed)) / 1e9;
+            return lower + (upper - lower) * (rank - static_cast<double>(below)) / static_cast<double>(counts[i]);
+        }
+        below += counts[i];
+    }
+    return static_cast<double>(_frameMaxNanoseconds.load(std::memory_order_relaxed)) / 1e9;
+}
+
+double Telemetry::sessionSeconds() const
+{
+    return static_cast<double>(steadyNanoseconds() - _startedSteady) / 1e9;
+}
+
+std::string Telemetry::toJson() const
+{
+    const double seconds = sessionSeconds();
+    const std::uint64_t ticks = _ticks.load(std::memory_order_relaxed);
+    const std::int64_t deathTick = _deathTick.load(std::memory_order_relaxed);
+    std::uint64_t frames = 0;
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"session\":" << _session << ",\"started_at_ms\":" << _startedAt << ",\"duration_s\":" << seconds;
+    json << ",\"frame_time_ms\":{\"p50\":" << frameTimePercentile(0.5) * 1000 << ",\"p90\":" << frameTimePercentile(0.9) * 1000
+        << ",\"p99\":" << frameTimePercentile(0.99) * 1000
+        << ",\"max\":" << static_cast<double>(_frameMaxNanoseconds.load(std::memory_order_relaxed)) / 1e6 << "}";
+    json << ",\"frame_time_histogram\":{\"bounds_ms\":[";
+    for (std::size_t i = 0; i < BUCKET_BOUNDS.size(); i++) {
+        json << (i > 0 ? "," : "") << BUCKET_BOUNDS[i] * 1000;
+    }
+    json << "],\"counts\":[";
+    for (std::size_t i = 0; i < BUCKETS; i++) {
+        const std::uint64_t count = _frameBuckets[i].load(std::memory_order_relaxed);
+        frames += count;
+        json << (i > 0 ? "," : "") << count;
+    }
+    json << "]},\"frames\":" << frames << ",\"ticks\":" << ticks
+        << ",\"ticks_per_second\":" << (seconds > 0 ? static_cast<double>(ticks) / seconds : 0)
+        << ",\"pipes_spawned\":" << _pipesSpawned.load(std::memory_order_relaxed)
+        << ",\"pipes_retired\":" << _pipesRetired.load(std::memory_order_relaxed)
+        << ",\"score\":" << _score.load(std::memory_order_relaxed)
+        << ",\"death_cause\":\"" << causeName(_deathCause.load(std::memory_order_relaxed)) << "\",\"death_tick\":";
+    if (deathTick < 0) {
+        json << "null";
+    } else {
+        json << deathTick;
+    }
+    json << "}";
+    return json.str();
+}
+
+std::string Telemetry::toPrometheus() const
+{
+    const double seconds = sessionSeconds();
+    const std::uint64_t ticks = _ticks.load(std::memory_order_relaxed);
+    const DeathCause cause = _deathCause.load(std::memory_order_relaxed);
+    std::ostringstream text;
+    text << "# HELP flappy_frame_time_seconds Time between two presented frames.\n"
+        << "# TYPE flappy_frame_time_seconds histogram\n";
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < BUCKETS; i++) {
+        cumulative += _frameBuckets[i].load(std::memory_order_relaxed);
+        text << "flappy_frame_time_seconds_bucket{le=\"";
+        if (i < BUCKET_BOUNDS.size()) {
+            text << BUCKET_BOUNDS[i];
+        } else {
+            text << "+Inf";
+        }
+        text << "\"} " << cumulative << "\n";
+    }
+    text << "flappy_frame_time_seconds_sum " << static_cast<double>(_frameNanoseconds.load(std::memory_order_relaxed)) / 1e9 << "\n"
+        << "flappy_frame_time_seconds_count " << cumulative << "\n"
+        << "# HELP flappy_frame_time_quantile_seconds Frame-time percentiles estimated from the histogram.\n"
+        << "# TYPE flappy_frame_time_quantile_seconds gauge\n"
+        << "flappy_frame_time_quantile_seconds{quantile=\"0.5\"} " << frameTimePercentile(0.5) << "\n"
+        << "flappy_frame_time_quantile_seconds{quantile=\"0.9\"} " << frameTimePercentile(0.9) << "\n"
+        << "flappy_frame_time_quantile_seconds{quantile=\"0.99\"} " << frameTimePercentile(0.99) << "\n"
+        << "# HELP flappy_session_duration_seconds Length of the session.\n"
+        << "# TYPE flappy_session_duration_seconds gauge\n"
+        << "flappy_session_duration_seconds " << seconds << "\n"
+        << "# HELP flappy_ticks_total Simulation steps run.\n"
+        << "# TYPE flappy_ticks_total counter\n"
+        << "flappy_ticks_total " << ticks << "\n"
+        << "# HELP flappy_ticks_per_second Simulation steps per second over the session.\n"
+        << "# TYPE flappy_ticks_per_second gauge\n"
+        << "flappy_ticks_per_second " << (seconds > 0 ? static_cast<double>(ticks) / seconds : 0) << "\n"
+        << "# HELP flappy_pipes_spawned_total Pipes spawned.\n"
+        << "# TYPE flappy_pipes_spawned_total counter\n"
+        << "flappy_pipes_spawned_total " << _pipesSpawned.load(std::memory_order_relaxed) << "\n"
+        << "# HELP flappy_pipes_retired_total Pipes that left the screen.\n"
+        << "# TYPE flappy_pipes_retired_total counter\n"
+        << "flappy_pipes_retired_total " << _pipesRetired.load(std::memory_order_relaxed) << "\n"
+        << "# HELP flappy_score Score of the session.\n"
+        << "# TYPE flappy_score gauge\n"
+        << "flappy_score " << _score.load(std::memory_order_relaxed) << "\n"
+        << "# HELP flappy_death Cause of the death, 1 for the cause that ended the session.\n"
+        << "# TYPE flappy_death gauge\n";
+    for (const DeathCause each : {DeathCause::GROUND, DeathCause::CEILING, DeathCause::PIPE}) {
+        text << "flappy_death{cause=\"" << causeName(each) << "\"} " << (each == cause ? 1 : 0) << "\n";
+    }
+    text << "# HELP flappy_death_tick Tick the bird died on, -1 if it did not.\n"
+        << "# TYPE flappy_death_tick gauge\n"
+        << "flappy_death_tick " << _deathTick.load(std::memory_order_relaxed) << "\n";
+    return text.str();
+}
+
+bool Telemetry::endSession()
+{
+    if (_directory.empty() || _exported) {
+        return false;
+    }
+    _exported = true;
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+    const std::filesystem::path directory(_directory);
+    std::ofstream jsonl(directory / "sessions.jsonl", std::ios::app);
+    jsonl << toJson() << "\n";
+    // Write then rename so a scraper never reads a half-written file.
+    const std::filesystem::path prometheus = directory / "flappy_bird.prom";
+    const std::filesystem::path temporary = directory / "flappy_bird.prom.tmp";
+    {
+        std::ofstream text(temporary, std::ios::trunc);
+        text << toPrometheus();
+        if (!text) {
+            return false;
+        }
+    }
+    std::filesystem::rename(temporary, prometheus, error);
+    return jsonl.good() && !error;
+}
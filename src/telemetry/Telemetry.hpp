@@ -0,0 +1,195 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Telemetry.hpp
+*/
+
+#ifndef STELLARFORGE_TELEMETRY_HPP
+#define STELLARFORGE_TELEMETRY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * @enum DeathCause
+ * @brief What ended the bird's flight.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+enum class DeathCause : std::uint8_t {
+    NONE, ///< The bird did not die
+    GROUND, ///< Fell below the ground bound
+    CEILING, ///< Flew above the ceiling bound
+    PIPE ///< Collided with a pipe
+};
+
+/**
+ * @class Telemetry
+ * @brief Per-session counters exported as JSONL and Prometheus text format.
+ *
+ * Every counter is a preallocated atomic updated with relaxed ordering, so
+ * recording never locks or allocates. The files are only written when the
+ * session ends. They go to the telemetry directory, which the
+ * FLAPPY_TELEMETRY_DIR environment variable overrides; "off" disables the
+ * export.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class Telemetry {
+public:
+    static constexpr const char *DEFAULT_DIRECTORY = "telemetry"; ///< Default export location
+    static constexpr std::size_t BUCKETS = 16; ///< Frame-time histogram buckets, the last one unbounded
+    static constexpr std::array<double, BUCKETS - 1> BUCKET_BOUNDS = {
+        0.001, 0.002, 0.004, 0.008, 0.012, 0.016, 0.017, 0.020, 0.025, 0.033, 0.050, 0.066, 0.100, 0.250, 1.000
+    }; ///< Upper bounds of the frame-time buckets in seconds
+
+    /**
+     * @brief Gets the telemetry of the running game.
+     * @return The Telemetry instance.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    static Telemetry &getInstance();
+
+    /**
+     * @brief Constructor for the Telemetry class.
+     * @param directory Export directory, empty to disable the export.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit Telemetry(std::string directory);
+
+    /**
+     * @brief Resets the counters and starts a new session.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void beginSession();
+
+    /**
+     * @brief Writes the session to disk, once per session.
+     * @return False if the export is disabled, was already done or failed.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    bool endSession();
+
+    /**
+     * @brief Records the time between two presented frames.
+     * @param seconds Frame time in seconds.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void recordFrame(float seconds);
+
+    /**
+     * @brief Records simulation steps.
+     * @param count Number of steps run.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void addTicks(std::uint32_t count) { _ticks.fetch_add(count, std::memory_order_relaxed); }
+
+    /**
+     * @brief Records spawned pipe pairs.
+     * @param count Number of pipe pairs spawned.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void addPipesSpawned(std::uint32_t count) { _pipesSpawned.fetch_add(count, std::memory_order_relaxed); }
+
+    /**
+     * @brief Records a pipe pair that left the screen.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void addPipeRetired() { _pipesRetired.fetch_add(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Records the current score.
+     * @param score Score of the session.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setScore(std::uint32_t score) { _score.store(score, std::memory_order_relaxed); }
+
+    /**
+     * @brief Records the death of the bird.
+     * @param cause What killed the bird.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void recordDeath(DeathCause cause);
+
+    /**
+     * @brief Estimates a frame-time percentile from the histogram.
+     * @param quantile Quantile in [0, 1].
+     * @return Frame time in seconds, interpolated inside its bucket.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] double frameTimePercentile(double quantile) const;
+
+    /**
+     * @brief Formats the session as one JSON line.
+     * @return The JSON object, without the trailing newline.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::string toJson() const;
+
+    /**
+     * @brief Formats the session in the Prometheus text exposition format.
+     * @return The metrics.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::string toPrometheus() const;
+
+private:
+    /**
+     * @brief Gets the session length so far.
+     * @return Seconds since beginSession.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] double sessionSeconds() const;
+
+    std::string _directory; ///< Export directory, empty when disabled
+    std::uint32_t _session = 0; ///< Sessions started by this process
+    std::int64_t _startedAt = 0; ///< Unix time of the session start in milliseconds
+    std::int64_t _startedSteady = 0; ///< Steady clock time of the session start in nanoseconds
+    bool _exported = false; ///< The session was already written
+    std::array<std::atomic<std::uint64_t>, BUCKETS> _frameBuckets {}; ///< Frame-time histogram
+    std::atomic<std::uint64_t> _frameNanoseconds {0}; ///< Sum of the frame times
+    std::atomic<std::uint64_t> _frameMaxNanoseconds {0}; ///< Longest frame time
+    std::atomic<std::uint64_t> _ticks {0}; ///< Simulation steps run
+    std::atomic<std::uint64_t> _pipesSpawned {0}; ///< Pipe pairs spawned
+    std::atomic<std::uint64_t> _pipesRetired {0}; ///< Pipe pairs that left the screen
+    std::atomic<std::uint32_t> _score {0}; ///< Current score
+    std::atomic<DeathCause> _deathCause {DeathCause::NONE}; ///< What killed the bird
+    std::atomic<std::int64_t> _deathTick {-1}; ///< Tick the bird died on, -1 while alive
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Telemetry counters must be lock-free");
+};
+
+#endif // STELLARFORGE_TELEMETRY_HPP
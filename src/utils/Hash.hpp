@@ -0,0 +1,56 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Hash.hpp
+*/
+
+#ifndef STELLARFORGE_HASH_HPP
+#define STELLARFORGE_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @namespace Hash
+ * @brief 64-bit FNV-1a hashing of bytes and plain values.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+namespace Hash {
+    constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ull; ///< Hash of no bytes
+    constexpr std::uint64_t FNV_PRIME = 1099511628211ull; ///< FNV-1a multiplier
+
+    /**
+     * @brief Hashes a byte range.
+     * @param data First byte.
+     * @param size Number of bytes.
+     * @param hash Hash to continue from.
+     * @return Hash of the bytes.
+     */
+    inline std::uint64_t bytes(const void *data, const std::size_t size, std::uint64_t hash = FNV_OFFSET)
+    {
+        const auto *cursor = static_cast<const std::uint8_t *>(data);
+        for (std::size_t i = 0; i < size; i++) {
+            hash = (hash ^ cursor[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Mixes a plain value into a hash.
+     * @param hash Hash to continue from.
+     * @param value Value to mix, hashed by its bytes.
+     * @return The new hash.
+     */
+    template <typename T>
+    std::uint64_t combine(const std::uint64_t hash, const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Hash::combine hashes the object representation");
+        return bytes(&value, sizeof(T), hash);
+    }
+}
+
+#endif // STELLARFORGE_HASH_HPP
@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Random.hpp
+*/
+
+#ifndef STELLARFORGE_RANDOM_HPP
+#define STELLARFORGE_RANDOM_HPP
+
+#include <cstdint>
+
+/**
+ * @class Random
+ * @brief Small xorshift32 generator whose whole state is one integer.
+ *
+ * Replaces rand() in the gameplay code so the pipe course can be seeded,
+ * snapshotted and replayed bit for bit.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class Random {
+public:
+    /**
+     * @brief Constructor for the Random class.
+     * @param seed Initial seed, zero is remapped since xorshift would stay stuck on it.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit Random(const std::uint32_t seed = 0x9E3779B9u) { setState(seed); }
+
+    /**
+     * @brief Draws the next 32 bits.
+     * @return The next pseudo-random value.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    std::uint32_t next()
+    {
+        _state ^= _state << 13;
+        _state ^= _state >> 17;
+        _state ^= _state << 5;
+        return _state;
+    }
+
+    /**
+     * @brief Draws an integer in [min, max).
+     * @param min Inclusive lower bound.
+     * @param max Exclusive upper bound.
+     * @return The drawn value.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    int range(const int min, const int max)
+    {
+        return min + static_cast<int>(next() % static_cast<std::uint32_t>(max - min));
+    }
+
+    /**
+     * @brief Gets the raw generator state.
+     * @return The generator state.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::uint32_t getState() const { return _state; }
+
+    /**
+     * @brief Sets the raw generator state.
+     * @param state New generator state.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void setState(const std::uint32_t state) { _state = state != 0 ? state : 0x9E3779B9u; }
+
+private:
+    std::uint32_t _state = 0x9E3779B9u; ///< Current xorshift state
+};
+
+#endif // STELLARFORGE_RANDOM_HPP
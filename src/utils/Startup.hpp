@@ -0,0 +1,36 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Startup.hpp
+*/
+
+#ifndef STELLARFORGE_STARTUP_HPP
+#define STELLARFORGE_STARTUP_HPP
+
+#include <chrono>
+
+/**
+ * @namespace Startup
+ * @brief Time elapsed since the process started, for startup measurements.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+namespace Startup {
+    /**
+     * @brief Time the program started, taken during static initialization.
+     */
+    inline const std::chrono::steady_clock::time_point LAUNCH = std::chrono::steady_clock::now();
+
+    /**
+     * @brief Gets the time elapsed since the program started.
+     * @return Milliseconds since launch.
+     */
+    inline double millisecondsSinceLaunch()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - LAUNCH).count();
+    }
+}
+
+#endif // STELLARFORGE_STARTUP_HPP
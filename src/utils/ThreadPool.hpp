@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** ThreadPool.hpp
+*/
+
+#ifndef STELLARFORGE_THREADPOOL_HPP
+#define STELLARFORGE_THREADPOOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads running queued tasks in order.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Constructor for the ThreadPool class.
+     * @param workers Number of threads, 0 for one per hardware thread.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    explicit ThreadPool(std::size_t workers = 0);
+
+    /**
+     * @brief Finishes the queued tasks and joins the workers.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Queues a task.
+     * @param task Callable without arguments.
+     * @return Future of the task result, rethrowing what the task threw.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    template <typename F>
+    std::future<std::invoke_result_t<F>> submit(F &&task)
+    {
+        auto packaged = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(task));
+        auto future = packaged->get_future();
+        {
+            const std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.emplace([packaged]() { (*packaged)(); });
+        }
+        _wake.notify_one();
+        return future;
+    }
+
+    /**
+     * @brief Gets the number of worker threads.
+     * @return The number of workers.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    [[nodiscard]] std::size_t size() const { return _workers.size(); }
+
+private:
+    /**
+     * @brief Body of a worker thread.
+     * @version v0.2.0
+     * @since v0.2.0
+     * @author Landry Gigant
+     */
+    void work();
+
+    std::vector<std::thread> _workers; ///< Worker threads
+    std::queue<std::function<void()>> _tasks; ///< Tasks not started yet
+    std::mutex _mutex; ///< Guards the queue and the stop flag
+    std::condition_variable _wake; ///< Signals new tasks or stop
+    bool _stopping = false; ///< Workers exit once the queue is empty
+};
+
+#endif // STELLARFORGE_THREADPOOL_HPP
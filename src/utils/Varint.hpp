@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2024
+** StellarForge
+** File description:
+** Varint.hpp
+*/
+
+#ifndef STELLARFORGE_VARINT_HPP
+#define STELLARFORGE_VARINT_HPP
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace Varint
+ * @brief LEB128 variable-length integers and zigzag mapping of signed values.
+ * @version v0.2.0
+ * @since v0.2.0
+ * @author Landry Gigant
+ */
+namespace Varint {
+    /**
+     * @brief Maps a signed value to an unsigned one so small magnitudes stay small.
+     * @param value Signed value.
+     * @return Zigzag-encoded value.
+     */
+    inline std::uint32_t zigzag(const std::int32_t value)
+    {
+        return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+    }
+
+    /**
+     * @brief Reverts zigzag.
+     * @param value Zigzag-encoded value.
+     * @return Signed value.
+     */
+    inline std::int32_t unzigzag(const std::uint32_t value)
+    {
+        return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1);
+    }
+
+    /**
+     * @brief Appends an unsigned value, 7 bits per byte.
+     * @param out Destination buffer.
+     * @param value Value to append.
+     */
+    inline void write(std::vector<std::uint8_t> &out, std::uint32_t value)
+    {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    /**
+     * @brief Appends a signed value.
+     * @param out Destination buffer.
+     * @param value Value to append.
+     */
+    inline void writeSigned(std::vector<std::uint8_t> &out, const std::int32_t value)
+    {
+        write(out, zigzag(value));
+    }
+
+    /**
+     * @brief Reads an unsigned value.
+     * @param cursor Read position, advanced past the value.
+     * @param end End of the readable bytes.
+     * @param value Read value.
+     * @return False if the bytes end in the middle of the value.
+     */
+    inline bool read(const std::uint8_t *&cursor, const std::uint8_t *end, std::uint32_t &value)
+    {
+        value = 0;
+        for (unsigned shift = 0; cursor < end && shift < 35; shift += 7) {
+            const std::uint8_t byte = *cursor++;
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Reads a signed value.
+     * @param cursor Read position, advanced past the value.
+     * @param end End of the readable bytes.
+     * @param value Read value.
+     * @return False if the bytes end in the middle of the value.
+     */
+    inline bool readSigned(const std::uint8_t *&cursor, const std::uint8_t *end, std::int32_t &value)
+    {
+        std::uint32_t raw = 0;
+        if (!read(cursor, end, raw)) {
+            return false;
+        }
+        value = unzigzag(raw);
+        return true;
+    }
+}
+
+#endif // STELLARFORGE_VARINT_HPP
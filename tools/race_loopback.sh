@@ -0,0 +1,23 @@
+#!/bin/sh
+# Runs a two-player race between two local processes on 127.0.0.1.
+# Usage: tools/race_loopback.sh [path/to/flappy-race] [extra flappy-race options...]
+# Example: tools/race_loopback.sh ./flappy-race --loss 0.1 --latency 50 --jitter 20
+
+RACE=${1:-./flappy-race}
+[ $# -gt 0 ] && shift
+
+"$RACE" --player 0 --port 7000 --peer-port 7001 "$@" > race_player0.log 2>&1 &
+PLAYER0=$!
+"$RACE" --player 1 --port 7001 --peer-port 7000 "$@" > race_player1.log 2>&1
+STATUS1=$?
+wait $PLAYER0
+STATUS0=$?
+
+cat race_player0.log race_player1.log
+CHECKSUM0=$(grep "final checksum" race_player0.log)
+CHECKSUM1=$(grep "final checksum" race_player1.log)
+if [ $STATUS0 -ne 0 ] || [ $STATUS1 -ne 0 ] || [ "$CHECKSUM0" != "$CHECKSUM1" ]; then
+    echo "race_loopback: peers disagree"
+    exit 1
+fi
+echo "race_loopback: peers agree"
@@ -0,0 +1,17 @@
+#!/bin/sh
+# Replays headless games with long steps against the 60 Hz game and fails if any death differs.
+# Usage: tools/swept_equivalence.sh [path/to/flappy-headless] [extra flappy-headless options...]
+# Example: tools/swept_equivalence.sh ./flappy-headless --seeds 2000
+
+HEADLESS=${1:-./flappy-headless}
+[ $# -gt 0 ] && shift
+
+STATUS=0
+for STEP in 16.6666667 50 100 200; do
+    "$HEADLESS" --compare --step "$STEP" "$@" || STATUS=1
+done
+if [ $STATUS -ne 0 ]; then
+    echo "swept_equivalence: long steps disagree with the 60 Hz game"
+    exit 1
+fi
+echo "swept_equivalence: long steps agree with the 60 Hz game"